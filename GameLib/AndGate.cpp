@@ -15,46 +15,20 @@ using namespace std;
 /// of the gate height.
 const double AndGateControlPointOffset = 0.75;
 
-/// Input pin width constant
-const double WidthConstant = 0.5;
-
-/// Height constant
-const double HeightConstant = 0.25;
-
-/// Zero constant
-const int Zero = 0;
-
-
-AndGate::AndGate(Game* game) : Gate(game)
-{
-	auto inputPin1 = make_shared<Pin>(game, PinType::INPUT, -mSize.GetWidth() * WidthConstant,
-									-mSize.GetHeight() * HeightConstant);
-	auto inputPin2 = make_shared<Pin>(game, PinType::INPUT, -mSize.GetWidth() * WidthConstant,
-									mSize.GetHeight() * HeightConstant);
-	auto outputPin1 = make_shared<Pin>(game, PinType::OUTPUT, mSize.GetWidth(), Zero);
-
-	mPins.push_back(inputPin1);
-	mPins.push_back(inputPin2);
-	mPins.push_back(outputPin1);
-
-}
-
 
 /**
  * Function to draw And gate
  * @param graphics graphics to use
+ * @param x X location of the center of the gate
+ * @param y Y location of the center of the gate
+ * @param w Width of the gate
+ * @param h Height of the gate
  */
-void AndGate::Draw(std::shared_ptr<wxGraphicsContext> graphics)
+void AndOp::Draw(std::shared_ptr<wxGraphicsContext> graphics, double x, double y, double w, double h)
 {
 	// Create a path to draw the gate shape
 	auto path = graphics->CreatePath();
 
-	// The location and size
-	auto x = GetX();
-	auto y = GetY();
-	auto w = GetSize().GetWidth();
-	auto h = GetSize().GetHeight();
-
 	// Draw the rectangular base first
 	path.MoveToPoint(x - w / 2, y + h / 2); // Start bottom left
 	path.AddLineToPoint(x - w / 2, y - h / 2); // Left vertical line
@@ -82,40 +56,4 @@ void AndGate::Draw(std::shared_ptr<wxGraphicsContext> graphics)
 	graphics->SetPen(*wxBLACK_PEN);
 	graphics->SetBrush(*wxWHITE_BRUSH);
 	graphics->DrawPath(path);
-
-
-	for (auto pin : mPins)
-	{
-		pin->Draw(graphics);
-	}
 }
-
-
-/**
- * Decides the output state of the gate
- */
-void AndGate::calculate()
-{
-	vector<shared_ptr<Pin>> inputPins = GetInputPins();
-
-
-	if (inputPins.size() >= 2 && inputPins[0] && inputPins[1])
-	{
-		PinState A = inputPins[0]->GetState();
-		PinState B = inputPins[1]->GetState();
-		shared_ptr<Pin> outputPin = GetOutputPins()[0];
-
-		if (A == PinState::UNKNOWN || B == PinState::UNKNOWN)
-		{
-			SetOutput(outputPin, PinState::UNKNOWN);
-		}
-		else if (A == PinState::ONE && B == PinState::ONE)
-		{
-			SetOutput(outputPin, PinState::ONE);
-		}
-		else
-		{
-			SetOutput(outputPin, PinState::ZERO);
-		}
-	}
-}
\ No newline at end of file
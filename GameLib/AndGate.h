@@ -7,49 +7,69 @@
 
 #ifndef ANDGATE_H
 #define ANDGATE_H
-#include "Gate.h"
-#include "Pin.h"
+#include "LogicGate.h"
 
 
 /**
- * class that represents and gate
- * Inherits from Gate class
+ * The AND function and shape for LogicGate
  */
-class AndGate : public Gate
+struct AndOp
 {
-private:
-	 /// Size of the AND gate in pixels
-	 const wxSize mSize =  wxSize (55, 50);
-
-	 /// Vector to hold 3 pins of And Gate
-	 //std::vector<std::shared_ptr<Pin>> mPins;
-
-public:
-	 // deleting default constructors
-	 AndGate() = delete;
-	 AndGate(const AndGate &) = delete;
-	 void operator=(const AndGate &) = delete;
-
-	 /**
-	  * constructor for and gate
-	  * @param game object of which the gate belongs to
-	  */
-	 AndGate(Game *game);
-
-	// Function to draw the gate
-	void Draw(std::shared_ptr<wxGraphicsContext> graphics) override;
-	/**
-	* virtual function to get size of gate
-	* @return size of gate
-	*/
-	const wxSize GetSize() override { return mSize; };
+	/// Operation the circuit compiler emits
+	static constexpr GateOp Op = GateOp::And;
+
+	/// Propagation delay of the AND gate in time units
+	static constexpr int Delay = 2;
+
+	/// Width of the two input AND gate in pixels
+	static constexpr int Width = 55;
+
+	/// Height of the two input AND gate in pixels
+	static constexpr int Height = 50;
 
-	void calculate() override;
+	/// How far the input pins are inside the left edge
+	static constexpr double InputInset = 0;
 
-	//std::vector<std::shared_ptr<Pin>> GetPins() {return mPins;}
+	/// How far the output pin is left of the gate width
+	static constexpr double OutputInset = 0;
 
+	/**
+	 * AND of all the inputs, UNKNOWN if any input is unknown
+	 * @param inputs States of the inputs
+	 * @return The output state
+	 */
+	template <size_t N>
+	static constexpr PinState Evaluate(const std::array<PinState, N>& inputs)
+	{
+		PinState result = PinState::ONE;
+		for (PinState input : inputs)
+		{
+			if (input == PinState::UNKNOWN)
+			{
+				return PinState::UNKNOWN;
+			}
+			if (input != PinState::ONE)
+			{
+				result = PinState::ZERO;
+			}
+		}
+		return result;
+	}
 
+	static void Draw(std::shared_ptr<wxGraphicsContext> graphics, double x, double y, double w, double h);
 };
 
+/// Two input AND gate
+using AndGate = LogicGate<AndOp, 2>;
+
+/// Three input AND gate
+using AndGate3 = LogicGate<AndOp, 3>;
+
+/// Four input AND gate
+using AndGate4 = LogicGate<AndOp, 4>;
+
+/// Eight input AND gate
+using AndGate8 = LogicGate<AndOp, 8>;
+
 
 #endif //ANDGATE_H
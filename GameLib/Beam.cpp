@@ -40,7 +40,7 @@ Beam::Beam(Game* game) : Item(game)
 	mRightSideRed = std::make_shared<wxImage>(mLeftSideRed->Mirror(true));
 	mRightSideGreen = std::make_shared<wxImage>(mLeftSideGreen->Mirror(true));
 
-	mPin = make_shared<Pin>(game, PinType::OUTPUT, XConstant, Zero, PinState::ZERO , Len);
+	mPin = game->MakePin(PinType::OUTPUT, XConstant, Zero, PinState::ZERO , Len);
 
 }
 
@@ -111,6 +111,15 @@ void Beam::Draw(std::shared_ptr<wxGraphicsContext> graphics)
 	mPin->Draw(graphics);
 }
 
+/**
+ * Draw the wires from the beam's pin
+ * @param graphics the graphics pointer
+ */
+void Beam::DrawWires(std::shared_ptr<wxGraphicsContext> graphics)
+{
+	mPin->DrawWires(graphics);
+}
+
 /**
  * Updater for beam
  * @param elapsed time since last update
@@ -130,7 +139,7 @@ void Beam::Update(double elapsed)
 	double beamCenterY = y;
 
 	ProductVisitor visitor(beamCenterY + YOffset, beamCenterX);
-	GetGame()->Accept(&visitor);
+	GetGame()->AcceptProducts(beamCenterY + YOffset, ProductDefaultSize, &visitor);
 
 	mBeamCrossed = !visitor.GetProducts().empty();
 
@@ -143,7 +152,6 @@ void Beam::Update(double elapsed)
 		mPin->SetState(PinState::ZERO);
 	}
     mPin->UpdateGatePosition(GetX(), GetY());
-	mPin->Update();
 
 }
 
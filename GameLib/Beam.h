@@ -8,6 +8,7 @@
 #ifndef BEAM_H
 #define BEAM_H
 #include "Item.h"
+#include "ItemVisitor.h"
 #include "Pin.h"
 
 /// Image for the beam sender and receiver when red
@@ -24,7 +25,7 @@ const int BeamPinOffset = 80;
  * Represents the beam on the belt
  * Inherits from Item class
  */
-class Beam : public Item
+class Beam final : public Item
 {
 private:
 	/// Distance to the left to place the beam sender image
@@ -59,10 +60,23 @@ public:
 
 	// Draw function
 	void Draw(std::shared_ptr<wxGraphicsContext> graphics) override;
+	void DrawWires(std::shared_ptr<wxGraphicsContext> graphics) override;
 
 	void Update(double elapsed) override;
 
     std::shared_ptr<Pin> PinHitTest(int x, int y) override;
+
+	/**
+	 * Getter for the output pin of the beam
+	 * @return The pin
+	 */
+	std::shared_ptr<Pin> GetPin() { return mPin; }
+
+	/**
+	 * Accept a visitor for the beam
+	 * @param visitor The visitor to accept
+	 */
+	void Accept(ItemVisitor* visitor) override { visitor->VisitBeam(this); }
 };
 
 
@@ -0,0 +1,210 @@
+/**
+ * @file BitParallelCircuit.cpp
+ * @author Ethan Springer, Daksh Mehta, Sehaj Gupta, Lukas Schaefer, Jack McNamara
+ */
+
+#include "pch.h"
+#include "BitParallelCircuit.h"
+
+using namespace std;
+
+/// Lane patterns of the low six bits of the lane number
+static const uint64_t LanePatterns[6] = {
+    0xaaaaaaaaaaaaaaaaull,
+    0xccccccccccccccccull,
+    0xf0f0f0f0f0f0f0f0ull,
+    0xff00ff00ff00ff00ull,
+    0xffff0000ffff0000ull,
+    0xffffffff00000000ull,
+};
+
+/**
+ * Constructor
+ *
+ * Every lane starts with the states of the compiled circuit
+ * and with all external inputs unknown.
+ * @param circuit Compiled circuit to evaluate, CanRun must be true for it
+ */
+BitParallelCircuit::BitParallelCircuit(const CompiledCircuit& circuit) :
+    mProgram(circuit.GetProgram()), mInputSlots(circuit.GetInputSlots()),
+    mOutputCount(circuit.GetOutputCount())
+{
+    assert(CanRun(circuit) && "BitParallelCircuit cannot run macros");
+
+    auto& state = circuit.GetState();
+    mState.resize(state.size() * Words);
+    for (size_t slot = 0; slot < mOutputCount; slot++)
+    {
+        for (int word = 0; word < Words; word++)
+        {
+            mState[slot * Words + word] = DualRail::Broadcast(state[slot]);
+        }
+    }
+
+    auto& memory = circuit.GetMemory();
+    mMemory.resize(memory.size() * Words);
+    for (size_t i = 0; i < memory.size(); i++)
+    {
+        for (int word = 0; word < Words; word++)
+        {
+            mMemory[i * Words + word] = DualRail::Broadcast(memory[i]);
+        }
+    }
+}
+
+/**
+ * Can a compiled circuit be evaluated in lanes.
+ *
+ * A macro runs the program of its definition over its own
+ * state, which has no lanes, so a circuit with a macro cannot.
+ * @param circuit Compiled circuit to check
+ * @return True if the circuit has no macros
+ */
+bool BitParallelCircuit::CanRun(const CompiledCircuit& circuit)
+{
+    for (const auto& instruction : circuit.GetProgram())
+    {
+        if (instruction.op == GateOp::Macro)
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+/**
+ * Set one external input in one lane
+ * @param input External input number
+ * @param lane Lane to set
+ * @param state New state of the input in that lane
+ */
+void BitParallelCircuit::SetInput(size_t input, int lane, PinState state)
+{
+    mState[(mOutputCount + input) * Words + lane / 64].Set(lane % 64, state);
+}
+
+/**
+ * Set the external inputs to count through input combinations.
+ *
+ * Lane i gets combination block * Lanes + i, where bit n of the
+ * combination is the state of external input n. Running blocks
+ * 0 to 2^inputs / Lanes covers every combination of ZERO and ONE.
+ * @param block Which group of Lanes combinations to set
+ */
+void BitParallelCircuit::SetExhaustiveInputs(uint64_t block)
+{
+    size_t inputs = GetInputCount();
+    for (size_t input = 0; input < inputs; input++)
+    {
+        DualRail* words = &mState[(mOutputCount + input) * Words];
+        for (int word = 0; word < Words; word++)
+        {
+            uint64_t first = block * Lanes + word * 64;
+            words[word].known = ~uint64_t(0);
+            if (input < 6)
+            {
+                words[word].value = LanePatterns[input];
+            }
+            else if (input < 64)
+            {
+                words[word].value = ((first >> input) & 1) ? ~uint64_t(0) : 0;
+            }
+            else
+            {
+                words[word].value = 0;
+            }
+        }
+    }
+}
+
+/**
+ * Get the state of a slot in one lane
+ * @param slot State slot
+ * @param lane Lane to read
+ * @return The state of the slot in that lane
+ */
+PinState BitParallelCircuit::GetState(size_t slot, int lane) const
+{
+    return mState[slot * Words + lane / 64].Get(lane % 64);
+}
+
+/**
+ * Run the instruction stream once in every lane
+ */
+void BitParallelCircuit::Run()
+{
+    DualRail* state = mState.data();
+    DualRail* memory = mMemory.data();
+
+    for (const auto& instruction : mProgram)
+    {
+        const uint32_t* in = mInputSlots.data() + instruction.firstInput;
+        DualRail* out = state + instruction.firstOutput * Words;
+
+        switch (instruction.op)
+        {
+        case GateOp::And:
+        case GateOp::Nand:
+            for (int word = 0; word < Words; word++)
+            {
+                DualRail result = state[in[0] * Words + word];
+                for (uint32_t i = 1; i < instruction.inputCount; i++)
+                {
+                    result = DualAnd(result, state[in[i] * Words + word]);
+                }
+                out[word] = instruction.op == GateOp::Nand ? DualNot(result) : result;
+            }
+            break;
+
+        case GateOp::Or:
+            for (int word = 0; word < Words; word++)
+            {
+                DualRail result = state[in[0] * Words + word];
+                for (uint32_t i = 1; i < instruction.inputCount; i++)
+                {
+                    result = DualOr(result, state[in[i] * Words + word]);
+                }
+                out[word] = result;
+            }
+            break;
+
+        case GateOp::Not:
+            for (int word = 0; word < Words; word++)
+            {
+                out[word] = DualNot(state[in[0] * Words + word]);
+            }
+            break;
+
+        case GateOp::DFlipFlop:
+            {
+                // Memory holds the last clock, Q and Q'
+                DualRail* mem = memory + instruction.memory * Words;
+                for (int word = 0; word < Words; word++)
+                {
+                    DualDFlipFlop(state[in[0] * Words + word], state[in[1] * Words + word],
+                                  mem[word], mem[Words + word], mem[2 * Words + word]);
+                    out[word] = mem[Words + word];
+                    out[Words + word] = mem[2 * Words + word];
+                }
+            }
+            break;
+
+        case GateOp::SRFlipFlop:
+            // The first input is R and the first output is Q'
+            for (int word = 0; word < Words; word++)
+            {
+                DualSRFlipFlop(state[in[1] * Words + word], state[in[0] * Words + word],
+                               out[Words + word], out[word]);
+            }
+            break;
+
+        case GateOp::Clock:
+            // The clock counts ticks itself, the output holds its state
+            break;
+
+        case GateOp::Macro:
+            // Rejected by the constructor
+            break;
+        }
+    }
+}
@@ -0,0 +1,80 @@
+/**
+ * @file BitParallelCircuit.h
+ * @author Ethan Springer, Daksh Mehta, Sehaj Gupta, Lukas Schaefer, Jack McNamara
+ *
+ * A compiled circuit evaluated for many input vectors at once
+ */
+
+#ifndef BITPARALLELCIRCUIT_H
+#define BITPARALLELCIRCUIT_H
+
+#include <cassert>
+#include <vector>
+#include "CompiledCircuit.h"
+#include "DualRail.h"
+
+/**
+ * A compiled circuit evaluated for many input vectors at once.
+ *
+ * Runs the instruction stream of a CompiledCircuit with every slot
+ * holding Lanes independent states as DualRail words, so one Run
+ * computes the circuit for Lanes different sets of inputs. Each
+ * instruction loops over the Words of a slot with no branches,
+ * which the compiler turns into vector instructions where the
+ * target has them.
+ *
+ * The circuit starts from the remembered states of the compiled
+ * circuit in every lane and keeps its own states from then on,
+ * so the game circuit is never changed.
+ */
+class BitParallelCircuit
+{
+public:
+    /// Words per slot, 256 lanes fill an AVX2 register
+    static const int Words = 4;
+
+    /// Input vectors evaluated by each Run
+    static const int Lanes = Words * 64;
+
+private:
+    /// The instruction stream, in evaluation order
+    std::vector<CompiledCircuit::Instruction> mProgram;
+
+    /// State slot read by each instruction input
+    std::vector<uint32_t> mInputSlots;
+
+    /// Number of gate output slots, the external slots follow them
+    size_t mOutputCount;
+
+    /// Words of each slot, slot * Words + word
+    std::vector<DualRail> mState;
+
+    /// Remembered states of the sequential gates, memory * Words + word
+    std::vector<DualRail> mMemory;
+
+public:
+    explicit BitParallelCircuit(const CompiledCircuit& circuit);
+
+    static bool CanRun(const CompiledCircuit& circuit);
+
+    void SetInput(size_t input, int lane, PinState state);
+    void SetExhaustiveInputs(uint64_t block);
+    PinState GetState(size_t slot, int lane) const;
+    void Run();
+
+    /**
+     * Get the number of external inputs
+     * @return Inputs not driven by a compiled gate
+     */
+    size_t GetInputCount() const { return mState.size() / Words - mOutputCount; }
+
+    /**
+     * Get the words of a slot
+     * @param slot State slot
+     * @return Pointer to the Words words of that slot
+     */
+    const DualRail* GetSlot(size_t slot) const { return &mState[slot * Words]; }
+};
+
+
+#endif //BITPARALLELCIRCUIT_H
@@ -0,0 +1,95 @@
+/**
+ * @file ClockGate.cpp
+ * @author Ethan Springer, Daksh Mehta, Sehaj Gupta, Lukas Schaefer, Jack McNamara
+ */
+
+#include "pch.h"
+#include "ClockGate.h"
+#include "Game.h"
+
+using namespace std;
+
+/// Const half
+const double ClockHalf = 0.5;
+
+/// Gap between the edge of the clock and the square wave
+const int ClockWaveMargin = 10;
+
+ClockGate::ClockGate(Game* game) : Gate(game)
+{
+	auto outputPin = game->MakePin(PinType::OUTPUT, mSize.GetWidth() * ClockHalf, 0, PinState::ZERO);
+
+	AddPin(outputPin);
+}
+
+/**
+ * The Draw function for the clock
+ * @param gc the graphics context to draw on
+ */
+void ClockGate::Draw(std::shared_ptr<wxGraphicsContext> gc)
+{
+	gc->SetPen(*wxBLACK_PEN);
+	gc->SetBrush(*wxWHITE_BRUSH);
+
+	auto w = GetSize().GetWidth();
+	auto h = GetSize().GetHeight();
+	auto x = GetX() - w * ClockHalf;
+	auto y = GetY() - h * ClockHalf;
+
+	gc->DrawRectangle(x, y, w, h);
+
+	// One period of a square wave across the face of the clock
+	double left = x + ClockWaveMargin;
+	double right = x + w - ClockWaveMargin;
+	double middle = (left + right) * ClockHalf;
+	double top = y + ClockWaveMargin;
+	double bottom = y + h - ClockWaveMargin;
+	wxPoint2DDouble wave[6] = {
+		wxPoint2DDouble(left, bottom),
+		wxPoint2DDouble(left, top),
+		wxPoint2DDouble(middle, top),
+		wxPoint2DDouble(middle, bottom),
+		wxPoint2DDouble(right, bottom),
+		wxPoint2DDouble(right, top)
+	};
+	gc->DrawLines(6, wave);
+
+	for (auto pin : mPins)
+	{
+		pin->Draw(gc);
+	}
+}
+
+/**
+ * Decides the output state of the gate
+ *
+ * Advances the clock by one tick
+ */
+void ClockGate::calculate()
+{
+	Sample();
+	Commit();
+}
+
+/**
+ * Count one tick, flipping the output once half a period has passed
+ */
+void ClockGate::Sample()
+{
+	PinState current = GetOutputPins()[0]->GetState();
+	mNextState = current;
+	if (++mTicks >= mHalfPeriod)
+	{
+		mTicks = 0;
+		mNextState = current == PinState::ONE ? PinState::ZERO : PinState::ONE;
+	}
+}
+
+/**
+ * Drive the output and ask to be latched again on the next tick
+ */
+void ClockGate::Commit()
+{
+	SetOutput(GetOutputPins()[0], mNextState);
+	OnInputChanged();
+}
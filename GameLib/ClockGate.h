@@ -0,0 +1,86 @@
+/**
+ * @file ClockGate.h
+ * @author Ethan Springer, Daksh Mehta, Sehaj Gupta, Lukas Schaefer, Jack McNamara
+ *
+ * A gate with no inputs whose output is a square wave
+ */
+
+#ifndef CLOCKGATE_H
+#define CLOCKGATE_H
+
+#include "Gate.h"
+#include "Pin.h"
+
+/// Default number of logic ticks between changes of the clock output
+const int DefaultClockHalfPeriod = 250;
+
+/**
+ * A gate with no inputs whose output is a square wave.
+ *
+ * The clock counts logic ticks, not frames, and changes its
+ * output every half period ticks in the commit phase of the
+ * tick, together with the flip flops. A flip flop clocked by
+ * it sees each edge on the following tick.
+ */
+class ClockGate : public Gate
+{
+private:
+	/// size of the gate
+	const wxSize mSize = wxSize(50, 50);
+
+	/// Ticks between changes of the output
+	int mHalfPeriod = DefaultClockHalfPeriod;
+
+	/// Ticks since the output last changed
+	int mTicks = 0;
+
+	/// State of the output on the next commit
+	PinState mNextState = PinState::ZERO;
+
+public:
+	ClockGate() = delete;
+	ClockGate(const ClockGate&) = delete;
+	void operator=(const ClockGate&) = delete;
+
+	ClockGate(Game* game);
+
+	void Draw(std::shared_ptr<wxGraphicsContext> gc) override;
+
+	/**
+	* Getter function for the size of the gate
+	* @return size of the gate
+	*/
+	const wxSize GetSize() override { return mSize; }
+
+	void calculate() override;
+
+	/**
+	 * Get the logic function of this gate
+	 * @return GateOp::Clock
+	 */
+	GateOp GetOp() const override { return GateOp::Clock; }
+
+	/**
+	 * The clock advances once per tick
+	 * @return true
+	 */
+	bool IsSequential() const override { return true; }
+
+	void Sample() override;
+	void Commit() override;
+
+	/**
+	 * Set the number of ticks between changes of the output
+	 * @param ticks Half the period of the clock in ticks, at least 1
+	 */
+	void SetHalfPeriod(int ticks) { mHalfPeriod = ticks > 0 ? ticks : 1; }
+
+	/**
+	 * Get the number of ticks between changes of the output
+	 * @return Half the period of the clock in ticks
+	 */
+	int GetHalfPeriod() const { return mHalfPeriod; }
+};
+
+
+#endif //CLOCKGATE_H
@@ -0,0 +1,321 @@
+/**
+ * @file CompiledCircuit.cpp
+ * @author Ethan Springer, Daksh Mehta, Sehaj Gupta, Lukas Schaefer, Jack McNamara
+ */
+
+#include "pch.h"
+#include "CompiledCircuit.h"
+#include "MacroGate.h"
+#include <unordered_map>
+
+using namespace std;
+
+/**
+ * AND of any number of inputs, UNKNOWN if any input is unknown
+ * @param state State array
+ * @param in Slots of the inputs
+ * @param count Number of inputs
+ * @return The output state
+ */
+static PinState EvaluateAnd(const PinState* state, const uint32_t* in, uint32_t count)
+{
+    PinState result = PinState::ONE;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        PinState input = state[in[i]];
+        if (input == PinState::UNKNOWN)
+        {
+            return PinState::UNKNOWN;
+        }
+        if (input != PinState::ONE)
+        {
+            result = PinState::ZERO;
+        }
+    }
+    return result;
+}
+
+/**
+ * OR of any number of inputs, UNKNOWN if any input is unknown
+ * @param state State array
+ * @param in Slots of the inputs
+ * @param count Number of inputs
+ * @return The output state
+ */
+static PinState EvaluateOr(const PinState* state, const uint32_t* in, uint32_t count)
+{
+    PinState result = PinState::ZERO;
+    for (uint32_t i = 0; i < count; i++)
+    {
+        PinState input = state[in[i]];
+        if (input == PinState::UNKNOWN)
+        {
+            return PinState::UNKNOWN;
+        }
+        if (input == PinState::ONE)
+        {
+            result = PinState::ONE;
+        }
+    }
+    return result;
+}
+
+/**
+ * Invert a known state, UNKNOWN stays unknown
+ * @param input State to invert
+ * @return The inverted state
+ */
+static PinState Invert(PinState input)
+{
+    if (input == PinState::ZERO)
+    {
+        return PinState::ONE;
+    }
+    if (input == PinState::ONE)
+    {
+        return PinState::ZERO;
+    }
+    return PinState::UNKNOWN;
+}
+
+/**
+ * Compile a gate network into an instruction stream.
+ *
+ * Any previously compiled program is replaced without
+ * storing its memory back into the gates.
+ * @param order Gates in the order to evaluate them
+ */
+void CompiledCircuit::Compile(const std::vector<Gate*>& order)
+{
+    mProgram.clear();
+    mGates = order;
+    mMacros.clear();
+    mInputSlots.clear();
+    mMemory.clear();
+    mOutputPins.clear();
+    mExternalPins.clear();
+
+    // Every output pin gets a slot, consecutive for each gate
+    unordered_map<Pin*, uint32_t> outputSlots;
+    for (Gate* gate : order)
+    {
+        for (const auto& pin : gate->GetOutputPins())
+        {
+            outputSlots[pin.get()] = mOutputPins.size();
+            mOutputPins.push_back(pin.get());
+        }
+    }
+
+    for (Gate* gate : order)
+    {
+        Instruction instruction;
+        instruction.op = gate->GetOp();
+        instruction.firstInput = mInputSlots.size();
+        instruction.firstOutput = outputSlots[gate->GetOutputPins()[0].get()];
+        instruction.memory = mMemory.size();
+
+        auto inputPins = gate->GetInputPins();
+        instruction.inputCount = inputPins.size();
+        for (const auto& pin : inputPins)
+        {
+            auto& connected = pin->GetConnectedPins();
+            if (!connected.empty())
+            {
+                auto driver = outputSlots.find(connected[0]);
+                if (driver != outputSlots.end())
+                {
+                    mInputSlots.push_back(driver->second);
+                    continue;
+                }
+            }
+
+            // Not driven by a compiled gate, load it from the pin
+            mInputSlots.push_back(outputSlots.size() + mExternalPins.size());
+            mExternalPins.push_back(pin.get());
+        }
+
+        mMemory.resize(mMemory.size() + gate->GetMemorySize());
+        gate->GetMemory(mMemory.data() + instruction.memory);
+
+        const MacroDefinition* macro = nullptr;
+        if (instruction.op == GateOp::Macro)
+        {
+            macro = static_cast<MacroGate*>(gate)->GetDefinition().get();
+        }
+        mMacros.push_back(macro);
+
+        mProgram.push_back(instruction);
+    }
+
+    mState.assign(mOutputPins.size() + mExternalPins.size(), PinState::UNKNOWN);
+    for (size_t i = 0; i < mOutputPins.size(); i++)
+    {
+        mState[i] = mOutputPins[i]->GetState();
+    }
+    mLoaded = true;
+}
+
+/**
+ * Run the instruction stream over the state array
+ */
+void CompiledCircuit::Execute()
+{
+    Execute(mState.data(), mMemory.data());
+}
+
+/**
+ * Run the instruction stream over state held somewhere else,
+ * such as by an instance of a macro
+ * @param state GetSlotCount() slot states
+ * @param memory GetMemory().size() remembered states
+ */
+void CompiledCircuit::Execute(PinState* state, PinState* memory) const
+{
+    const uint32_t* inputSlots = mInputSlots.data();
+
+    for (size_t i = 0; i < mProgram.size(); i++)
+    {
+        const Instruction& instruction = mProgram[i];
+        const uint32_t* in = inputSlots + instruction.firstInput;
+        PinState* out = state + instruction.firstOutput;
+
+        switch (instruction.op)
+        {
+        case GateOp::And:
+            out[0] = EvaluateAnd(state, in, instruction.inputCount);
+            break;
+
+        case GateOp::Or:
+            out[0] = EvaluateOr(state, in, instruction.inputCount);
+            break;
+
+        case GateOp::Nand:
+            out[0] = Invert(EvaluateAnd(state, in, instruction.inputCount));
+            break;
+
+        case GateOp::Not:
+            out[0] = Invert(state[in[0]]);
+            break;
+
+        case GateOp::DFlipFlop:
+            {
+                // Memory holds the last clock, Q and Q'
+                PinState* mem = memory + instruction.memory;
+                PinState d = state[in[0]];
+                PinState clk = state[in[1]];
+                if (mem[0] == PinState::ZERO && clk == PinState::ONE)
+                {
+                    mem[1] = d;
+                    mem[2] = (d == PinState::ONE) ? PinState::ZERO : PinState::ONE;
+                }
+                out[0] = mem[1];
+                out[1] = mem[2];
+                mem[0] = clk;
+            }
+            break;
+
+        case GateOp::SRFlipFlop:
+            {
+                // The first input is R and the first output is Q'
+                PinState r = state[in[0]];
+                PinState s = state[in[1]];
+                if (s == PinState::ONE && r == PinState::ONE)
+                {
+                    out[0] = PinState::UNKNOWN;
+                    out[1] = PinState::UNKNOWN;
+                }
+                else if (r == PinState::ONE)
+                {
+                    out[0] = PinState::ONE;
+                    out[1] = PinState::ZERO;
+                }
+                else if (s == PinState::ONE)
+                {
+                    out[0] = PinState::ZERO;
+                    out[1] = PinState::ONE;
+                }
+            }
+            break;
+
+        case GateOp::Clock:
+            // The clock counts ticks itself, the output holds its state
+            break;
+
+        case GateOp::Macro:
+            {
+                // Memory holds the state of the instance
+                const MacroDefinition* macro = mMacros[i];
+                PinState* instance = memory + instruction.memory;
+                for (uint32_t j = 0; j < instruction.inputCount; j++)
+                {
+                    macro->SetInput(instance, j, state[in[j]]);
+                }
+                macro->Run(instance);
+                for (size_t j = 0; j < macro->GetOutputCount(); j++)
+                {
+                    out[j] = macro->GetOutput(instance, j);
+                }
+            }
+            break;
+        }
+    }
+}
+
+/**
+ * Load the external inputs, run the program and
+ * set the output pins from the result
+ */
+void CompiledCircuit::Run()
+{
+    size_t external = mOutputPins.size();
+    for (size_t i = 0; i < mExternalPins.size(); i++)
+    {
+        mState[external + i] = mExternalPins[i]->GetState();
+    }
+
+    Execute();
+
+    for (size_t i = 0; i < mOutputPins.size(); i++)
+    {
+        mOutputPins[i]->SetState(mState[i]);
+    }
+}
+
+/**
+ * Store the remembered states back into the gates
+ * and discard the program
+ */
+void CompiledCircuit::Unload()
+{
+    for (size_t i = 0; i < mProgram.size(); i++)
+    {
+        if (mGates[i]->GetMemorySize() > 0)
+        {
+            mGates[i]->SetMemory(mMemory.data() + mProgram[i].memory);
+        }
+    }
+
+    mProgram.clear();
+    mGates.clear();
+    mMacros.clear();
+    mInputSlots.clear();
+    mState.clear();
+    mMemory.clear();
+    mOutputPins.clear();
+    mExternalPins.clear();
+    mLoaded = false;
+}
+
+/**
+ * Forget the gates and pins the program was compiled from.
+ *
+ * The program can still be run with Execute, but no longer
+ * loads or sets pins, so the gates can be destroyed.
+ */
+void CompiledCircuit::Detach()
+{
+    mGates.clear();
+    mOutputPins.clear();
+    mExternalPins.clear();
+    mLoaded = false;
+}
@@ -0,0 +1,150 @@
+/**
+ * @file CompiledCircuit.h
+ * @author Ethan Springer, Daksh Mehta, Sehaj Gupta, Lukas Schaefer, Jack McNamara
+ *
+ * A gate network flattened into a linear instruction stream
+ */
+
+#ifndef COMPILEDCIRCUIT_H
+#define COMPILEDCIRCUIT_H
+
+#include <cstdint>
+#include <vector>
+#include "Gate.h"
+#include "Pin.h"
+
+class MacroDefinition;
+
+/**
+ * A gate network flattened into a linear instruction stream.
+ *
+ * Every output pin of every gate gets a slot in one contiguous
+ * state array, and every gate becomes an instruction reading its
+ * input slots and writing its output slots. Inputs that are not
+ * driven by a compiled gate (unwired inputs, property boxes and
+ * beams) get slots that are loaded from the input pins before
+ * each run. After a run the output pins are set from their slots,
+ * so the Pin objects just mirror the compiled state for drawing.
+ *
+ * A MacroGate compiles to a single instruction that runs the
+ * program of its MacroDefinition over the instance state, which
+ * is kept with the remembered states of the flip flops.
+ */
+class CompiledCircuit
+{
+public:
+    /// One gate in the instruction stream
+    struct Instruction
+    {
+        /// Logic function to compute
+        GateOp op;
+        /// Index of the first input slot in the input slot table
+        uint32_t firstInput;
+        /// Number of input slots
+        uint32_t inputCount;
+        /// State slot of the first output, the outputs are consecutive
+        uint32_t firstOutput;
+        /// Index of the first remembered state in the memory array
+        uint32_t memory;
+    };
+
+private:
+    /// The instruction stream, in evaluation order
+    std::vector<Instruction> mProgram;
+
+    /// Gates the instructions were compiled from, same order as mProgram
+    std::vector<Gate*> mGates;
+
+    /// Definition run by each macro instruction, nullptr for the others
+    std::vector<const MacroDefinition*> mMacros;
+
+    /// State slot read by each instruction input
+    std::vector<uint32_t> mInputSlots;
+
+    /// The state of every slot
+    std::vector<PinState> mState;
+
+    /// States the sequential gates remember between runs
+    std::vector<PinState> mMemory;
+
+    /// Output pin mirrored from each of the first slots
+    std::vector<Pin*> mOutputPins;
+
+    /// Input pins loaded into the external slots, which follow the output slots
+    std::vector<Pin*> mExternalPins;
+
+    /// True once Compile has run and until Unload is called
+    bool mLoaded = false;
+
+    void Execute();
+
+public:
+    void Compile(const std::vector<Gate*>& order);
+    void Run();
+    void Unload();
+    void Detach();
+    void Execute(PinState* state, PinState* memory) const;
+
+    /**
+     * Is there a compiled program to run
+     * @return True if compiled and not unloaded since
+     */
+    bool IsLoaded() const { return mLoaded; }
+
+    /**
+     * Get the compiled instructions
+     * @return Instructions in evaluation order
+     */
+    const std::vector<Instruction>& GetProgram() const { return mProgram; }
+
+    /**
+     * Get the state slot read by each instruction input
+     * @return Slots indexed from Instruction::firstInput
+     */
+    const std::vector<uint32_t>& GetInputSlots() const { return mInputSlots; }
+
+    /**
+     * Get the state of every slot
+     * @return States as of the last run
+     */
+    const std::vector<PinState>& GetState() const { return mState; }
+
+    /**
+     * Get the remembered states of the sequential gates
+     * @return States indexed from Instruction::memory
+     */
+    const std::vector<PinState>& GetMemory() const { return mMemory; }
+
+    /**
+     * Get the number of gate output slots
+     * @return Number of output slots, the external slots follow them
+     */
+    size_t GetOutputCount() const { return mOutputPins.size(); }
+
+    /**
+     * Get the number of external input slots
+     * @return Inputs not driven by a compiled gate
+     */
+    size_t GetExternalCount() const { return mExternalPins.size(); }
+
+    /**
+     * Get the pins mirrored from the output slots
+     * @return Output pins, in the order of the slots
+     */
+    const std::vector<Pin*>& GetOutputPins() const { return mOutputPins; }
+
+    /**
+     * Get the pins loaded into the external slots
+     * @return Input pins, in the order of the external slots
+     */
+    const std::vector<Pin*>& GetExternalPins() const { return mExternalPins; }
+
+    /**
+     * Get the number of state slots
+     * @return Gate output slots plus external input slots
+     */
+    size_t GetSlotCount() const { return mState.size(); }
+};
+
+
+#endif //COMPILEDCIRCUIT_H
@@ -6,9 +6,8 @@
 #include "pch.h"
 #include "Conveyor.h"
 #include "Product.h"
-#include "ProductVisitor.h"
 #include "Sparty.h"
-#include "SpartyVisitor.h"
+#include <algorithm>
 
 
 /**
@@ -52,20 +51,20 @@ void Conveyor::XmlLoad(wxXmlNode* node)
     {
         if (product->GetName() == L"product")
         {
-            std::shared_ptr<Product> prod = std::make_shared<Product>(Item::GetGame(), yCoordOffset);
+            std::shared_ptr<Product> prod = GetGame()->MakeLevelItem<Product>(yCoordOffset);
             GetGame()->Add(prod);
             prod->XmlLoad(product);
             yCoordOffset = prod->GetY();
             prod->SetLocation(this->GetX(), prod->GetY() + this->GetY());
+            AddProduct(prod.get());
         }
     }
     // Calculates out how far that the conveyor has to travel for the game to end
-    SpartyVisitor visitor;
-    GetGame()->Accept(&visitor);
+    Sparty* sparty = GetGame()->GetRegistry().GetSparty();
     double spartyKickY = 0;
-    if (visitor.GetSparty() != nullptr)
+    if (sparty != nullptr)
     {
-        spartyKickY = visitor.GetSparty()->GetKickY();
+        spartyKickY = sparty->GetKickY();
     }
     mDistanceToEnd = spartyKickY - yCoordOffset + mSpeed * LastProductDelay + ProductDefaultSize;
 }
@@ -182,12 +181,8 @@ void Conveyor::Update(double elapsed)
 void Conveyor::ResetPosition()
 {
     mOffset = 0;
-    ProductVisitor visitor;
-    GetGame()->Accept(&visitor);
-    for (auto product : visitor.GetProducts())
-    {
-        product->ResetPosition();
-    }
+    GetGame()->GetProductStore().Reset();
+    mKicked.clear();
     GetGame()->GetScore()->ResetLevelScore();
 }
 
@@ -202,3 +197,68 @@ bool Conveyor::IsLevelDone()
 {
     return mOffset >= mDistanceToEnd;
 }
+
+/**
+ * Add a product to the belt, keeping the products sorted by y.
+ *
+ * The y location is also kept in the product store, to tell
+ * when the product passes Sparty.
+ * @param product Product that has been placed on the belt
+ */
+void Conveyor::AddProduct(Product* product)
+{
+    auto at = std::upper_bound(mProducts.begin(), mProducts.end(), product->GetY(),
+                               [](double y, Product* other) { return y < other->GetY(); });
+    mProducts.insert(at, product);
+    GetGame()->GetProductStore().SetBaseY(product->GetSlot(), product->GetY());
+}
+
+/**
+ * Tell the belt a product has been kicked off it.
+ *
+ * A kicked product stops moving with the belt, so it is
+ * searched separately until the belt is started again.
+ * @param product The product that was kicked
+ */
+void Conveyor::OnKicked(Product* product)
+{
+    if (std::find(mKicked.begin(), mKicked.end(), product) == mKicked.end())
+    {
+        mKicked.push_back(product);
+    }
+}
+
+/**
+ * Accept a visitor for the products near a y location.
+ *
+ * The products still on the belt are found by a binary search
+ * on their y location plus the belt offset, then the kicked
+ * products are all visited. The visitor gets every product that
+ * can be within range / 2 of y, and any that are a little
+ * further, so it should check the location itself.
+ * @param y Y location to search around
+ * @param range Size of the search
+ * @param visitor Pointer to the ItemVisitor to be used
+ */
+void Conveyor::AcceptProducts(double y, double range, ItemVisitor* visitor)
+{
+    // The products take the belt offset after the items update each
+    // tick, so they may be a tick behind. A product size of slack covers that.
+    double low = y - range / 2 - mOffset - ProductDefaultSize;
+    double high = y + range / 2 - mOffset + ProductDefaultSize;
+
+    auto product = std::lower_bound(mProducts.begin(), mProducts.end(), low,
+                                    [](Product* other, double value) { return other->GetY() < value; });
+    for (; product != mProducts.end() && (*product)->GetY() <= high; ++product)
+    {
+        if (!(*product)->IsKicked())
+        {
+            (*product)->Accept(visitor);
+        }
+    }
+
+    for (auto kicked : mKicked)
+    {
+        kicked->Accept(visitor);
+    }
+}
@@ -9,6 +9,9 @@
 #define CONVEYOR_H
 #include "Item.h"
 #include "ItemVisitor.h"
+#include <vector>
+
+class Product;
 
 
 /// Image for the background (base) of the conveyor
@@ -31,7 +34,7 @@ const wxRect StopButtonRect = wxRect(35, 87, 95, 36);
 
 
 /// Class for the conveyor
-class Conveyor : public Item
+class Conveyor final : public Item
 {
 private:
     /// The speed of the conveyor
@@ -74,6 +77,13 @@ private:
     /// Distance conveyor can move until level ends
     double mDistanceToEnd = 0.0;
 
+    /// The products loaded on the belt, sorted by their y location.
+    /// They all move with the belt, so the order never changes.
+    std::vector<Product*> mProducts;
+
+    /// Products kicked off the belt since it was last started
+    std::vector<Product*> mKicked;
+
 public:
     Conveyor(Game* game);
 
@@ -81,12 +91,22 @@ public:
 
     void Draw(std::shared_ptr<wxGraphicsContext> gc) override;
 
+    /**
+     * The conveyor is drawn below everything else
+     * @return The conveyor layer
+     */
+    Layer GetLayer() const override { return Layer::Conveyor; }
+
     bool HitTest(int x, int y) override;
 
     void Update(double) override;
     void ResetPosition();
     bool IsLevelDone();
 
+    void AddProduct(Product* product);
+    void OnKicked(Product* product);
+    void AcceptProducts(double y, double range, ItemVisitor* visitor);
+
     /**
      * Accepts a visitor for the conveyor.
      *
@@ -5,70 +5,330 @@
 
 #include "pch.h"
 #include "DependencyGraph.h"
+#include <algorithm>
 
 using namespace std;
 
 /**
- * Makes the initial graph needed for sorting
+ * Makes the initial graph needed for sorting from the
+ * wires connected to the output pins of the gates
  * @param gates Logic gates items
  */
 void DependencyGraph::BuildDependencyGraph(const std::vector<Gate*>& gates)
 {
 	for (Gate* gate : gates)
 	{
-		for (shared_ptr<Pin> inputPin : gate->GetInputPins())
+		for (const auto& outputPin : gate->GetOutputPins())
 		{
-			Gate* sourceGate = inputPin->getSourceGate();
-			if (sourceGate)
+			for (auto& connected : outputPin->GetConnectedPins())
 			{
-				mAdjList[sourceGate].push_back(gate);
-				mDegrees[gate]++;
+				Gate* dependent = connected->getSourceGate();
+				if (dependent)
+				{
+					AddDependency(gate, dependent);
+				}
 			}
 		}
 	}
 }
 
 /**
- * Preforms the sorting process
- * @param gates Logic gates items
- * @return A vector of the gates in the correct order
+ * Record that a gate depends on the output of another gate
+ * @param source Gate whose output is read
+ * @param dependent Gate reading that output
+ */
+void DependencyGraph::AddDependency(Gate* source, Gate* dependent)
+{
+	Handle handle = source->GetHandle();
+	if (mNodes.size() <= handle.GetIndex())
+	{
+		mNodes.resize(handle.GetIndex() + 1);
+	}
+
+	// A node left by a destroyed gate in the same slot is stale
+	Node& node = mNodes[handle.GetIndex()];
+	if (node.generation != handle.GetGeneration())
+	{
+		node.generation = handle.GetGeneration();
+		node.dependents.clear();
+	}
+	node.dependents.push_back(dependent);
+}
+
+/**
+ * Get the gates that depend on a gate
+ * @param gate Gate whose output is read
+ * @return The gates reading its outputs, once per wire
+ */
+const vector<Gate*>& DependencyGraph::GetDependents(Gate* gate) const
+{
+	static const vector<Gate*> none;
+	Handle handle = gate->GetHandle();
+	return HasNode(handle) ? mNodes[handle.GetIndex()].dependents : none;
+}
+
+/**
+ * Is there a node for a gate, not left over from a destroyed gate
+ * @param handle Handle of the gate
+ * @return True if the gate has had dependencies added
  */
-vector<Gate*> DependencyGraph::TopologicalSort(const vector<Gate*>& gates)
+bool DependencyGraph::HasNode(Handle handle) const
 {
-	vector<Gate*> sortedGates;
-	queue<Gate*> toProcess;
+	return handle.GetIndex() < mNodes.size() && mNodes[handle.GetIndex()].generation == handle.GetGeneration();
+}
 
-	// Initialize the queue with gates that have no dependencies.
+/**
+ * Get the size of a table indexed by the handles of the gates
+ * @param gates Gates being sorted
+ * @return One more than the highest handle index of any gate
+ * being sorted or in the graph
+ */
+size_t DependencyGraph::GetBound(const vector<Gate*>& gates) const
+{
+	size_t bound = mNodes.size();
 	for (Gate* gate : gates)
 	{
-		if (mDegrees[gate] == 0)
+		bound = max<size_t>(bound, gate->GetHandle().GetIndex() + 1);
+	}
+	for (const Node& node : mNodes)
+	{
+		for (Gate* dependent : node.dependents)
+		{
+			bound = max<size_t>(bound, dependent->GetHandle().GetIndex() + 1);
+		}
+	}
+	return bound;
+}
+
+/**
+ * Remove one dependency previously added with AddDependency
+ * @param source Gate whose output was read
+ * @param dependent Gate that was reading that output
+ */
+void DependencyGraph::RemoveDependency(Gate* source, Gate* dependent)
+{
+	Handle handle = source->GetHandle();
+	if (!HasNode(handle))
+	{
+		return;
+	}
+
+	auto& dependents = mNodes[handle.GetIndex()].dependents;
+	auto loc = find(dependents.begin(), dependents.end(), dependent);
+	if (loc != dependents.end())
+	{
+		dependents.erase(loc);
+	}
+}
+
+/**
+ * Remove a gate and every dependency it takes part in
+ * @param gate Gate to remove
+ */
+void DependencyGraph::RemoveGate(Gate* gate)
+{
+	Handle handle = gate->GetHandle();
+	if (HasNode(handle))
+	{
+		mNodes[handle.GetIndex()] = Node();
+	}
+
+	for (auto& node : mNodes)
+	{
+		auto& dependents = node.dependents;
+		dependents.erase(remove(dependents.begin(), dependents.end(), gate), dependents.end());
+	}
+}
+
+/**
+ * Remove all gates and dependencies from the graph
+ */
+void DependencyGraph::Clear()
+{
+	mNodes.clear();
+}
+
+/**
+ * Find the strongly connected components of the graph.
+ *
+ * Uses Tarjan's algorithm, without recursion so a long chain of
+ * gates cannot overflow the stack. Every gate in a feedback loop
+ * ends up in the same component, and every other gate is in a
+ * component of its own.
+ * @param gates Logic gates items
+ * @return The components, every component before the ones it drives
+ */
+vector<vector<Gate*>> DependencyGraph::Components(const vector<Gate*>& gates) const
+{
+	vector<vector<Gate*>> components;
+
+	// Tables indexed by the handle of a gate, index -1 for a gate not visited yet
+	size_t bound = GetBound(gates);
+	vector<int> index(bound, -1);
+	vector<int> low(bound, 0);
+	vector<char> onStack(bound, 0);
+	vector<Gate*> stack;
+
+	/// A gate being visited and the next dependent to look at
+	struct Visit
+	{
+		Gate* gate;
+		size_t next;
+	};
+	vector<Visit> visits;
+	int nextIndex = 0;
+
+	for (Gate* root : gates)
+	{
+		size_t r = root->GetHandle().GetIndex();
+		if (index[r] >= 0)
+		{
+			continue;
+		}
+
+		index[r] = low[r] = nextIndex++;
+		stack.push_back(root);
+		onStack[r] = true;
+		visits.push_back({root, 0});
+
+		while (!visits.empty())
 		{
-			toProcess.push(gate);
+			Gate* gate = visits.back().gate;
+			size_t g = gate->GetHandle().GetIndex();
+			const auto& dependents = GetDependents(gate);
+			if (visits.back().next < dependents.size())
+			{
+				Gate* dependent = dependents[visits.back().next++];
+				size_t d = dependent->GetHandle().GetIndex();
+				if (index[d] < 0)
+				{
+					index[d] = low[d] = nextIndex++;
+					stack.push_back(dependent);
+					onStack[d] = true;
+					visits.push_back({dependent, 0});
+				}
+				else if (onStack[d])
+				{
+					low[g] = min(low[g], index[d]);
+				}
+				continue;
+			}
+
+			// All dependents visited, the gate may be the root of a component
+			if (low[g] == index[g])
+			{
+				vector<Gate*> component;
+				Gate* member;
+				do
+				{
+					member = stack.back();
+					stack.pop_back();
+					onStack[member->GetHandle().GetIndex()] = false;
+					component.push_back(member);
+				} while (member != gate);
+				components.push_back(component);
+			}
+
+			visits.pop_back();
+			if (!visits.empty())
+			{
+				size_t parent = visits.back().gate->GetHandle().GetIndex();
+				low[parent] = min(low[parent], low[g]);
+			}
 		}
 	}
 
-	while (!toProcess.empty())
+	// Tarjan finds the components that drive nothing first
+	reverse(components.begin(), components.end());
+	return components;
+}
+
+/**
+ * Is a component a feedback loop
+ * @param component Component found by Components
+ * @return True if the gates in the component drive themselves
+ */
+bool DependencyGraph::IsLoop(const vector<Gate*>& component) const
+{
+	if (component.size() > 1)
+	{
+		return true;
+	}
+
+	const auto& dependents = GetDependents(component[0]);
+	return find(dependents.begin(), dependents.end(), component[0]) != dependents.end();
+}
+
+/**
+ * Preforms the sorting process, grouping the gates into logic levels.
+ *
+ * A gate's level is one more than the highest level of the gates
+ * driving it, so evaluating the levels in order settles any
+ * combinational circuit in a single pass. A feedback loop is
+ * levelled as one unit: all of its gates share the level of the
+ * loop, which comes after every gate driving the loop from outside.
+ * Within a level the gates keep the order they were given in.
+ * @param gates Logic gates items
+ * @return The gates of each level, lowest level first
+ */
+vector<vector<Gate*>> DependencyGraph::Levelize(const vector<Gate*>& gates) const
+{
+	auto components = Components(gates);
+
+	vector<size_t> componentOf(GetBound(gates), 0);
+	for (size_t c = 0; c < components.size(); c++)
 	{
-		Gate* current = toProcess.front();
-		toProcess.pop();
-		sortedGates.push_back(current);
+		for (Gate* gate : components[c])
+		{
+			componentOf[gate->GetHandle().GetIndex()] = c;
+		}
+	}
 
-		for (Gate* dependent : mAdjList[current])
+	// Components come before the ones they drive, so one pass is enough
+	vector<int> componentLevels(components.size(), 0);
+	for (size_t c = 0; c < components.size(); c++)
+	{
+		for (Gate* gate : components[c])
 		{
-			mDegrees[dependent]--;
-			if (mDegrees[dependent] == 0)
+			for (Gate* dependent : GetDependents(gate))
 			{
-				toProcess.push(dependent);
+				size_t d = componentOf[dependent->GetHandle().GetIndex()];
+				if (d != c)
+				{
+					componentLevels[d] = max(componentLevels[d], componentLevels[c] + 1);
+				}
 			}
 		}
 	}
 
-	// Cycle error
-	if (sortedGates.size() != gates.size())
+	vector<vector<Gate*>> levels;
+	for (Gate* gate : gates)
 	{
-		throw runtime_error("Error: Cycle Detected");
+		size_t level = componentLevels[componentOf[gate->GetHandle().GetIndex()]];
+		if (levels.size() <= level)
+		{
+			levels.resize(level + 1);
+		}
+		levels[level].push_back(gate);
 	}
 
-	return sortedGates;
+	return levels;
 }
 
+/**
+ * Find the feedback loops in the graph
+ * @param gates Logic gates items
+ * @return The gates of each loop, every loop before the ones it drives
+ */
+vector<vector<Gate*>> DependencyGraph::FindLoops(const vector<Gate*>& gates) const
+{
+	vector<vector<Gate*>> loops;
+	for (auto& component : Components(gates))
+	{
+		if (IsLoop(component))
+		{
+			loops.push_back(component);
+		}
+	}
+	return loops;
+}
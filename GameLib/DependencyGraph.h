@@ -8,28 +8,55 @@
 #ifndef DEPENDENCYGRAPH_H
 #define DEPENDENCYGRAPH_H
 
-#include <unordered_map>
 #include <vector>
-#include <queue>
 #include "Gate.h"
 #include "Pin.h"
 
 /**
  * Dependency Graph used for Topological Sorting
+ *
+ * An edge runs from a gate to every gate with an input wired
+ * to one of its outputs. The graph is persistent: gates and
+ * dependencies can be added and removed one at a time, and
+ * sorting does not consume it.
+ *
+ * Feedback loops are found as strongly connected components,
+ * so a loop is sorted as a single unit among the other gates.
+ *
+ * Gates are looked up by the index of their handle, so the graph
+ * and the tables used while sorting are plain vectors.
  */
 class DependencyGraph
 {
 private:
-	/// Keeps track of Adjacent Gates
-	std::unordered_map<Gate*, std::vector<Gate*>> mAdjList;
-	/// Keeps track of the Degrees of Gates
-	std::unordered_map<Gate*, int> mDegrees;
+	/// The gates driven by one gate
+	struct Node
+	{
+		/// Generation of the handle of the gate, 0 for an unused node
+		uint32_t generation = 0;
+		/// Gates with an input wired to an output of the gate
+		std::vector<Gate*> dependents;
+	};
+
+	/// Keeps track of Adjacent Gates, indexed by the handle of the gate
+	std::vector<Node> mNodes;
+
+	bool HasNode(Handle handle) const;
+	const std::vector<Gate*>& GetDependents(Gate* gate) const;
+	size_t GetBound(const std::vector<Gate*>& gates) const;
+	bool IsLoop(const std::vector<Gate*>& component) const;
+
 public:
 	void BuildDependencyGraph(const std::vector<Gate*>& gates);
 
-	std::vector<Gate*> TopologicalSort(const std::vector<Gate*>& gates);
+	void AddDependency(Gate* source, Gate* dependent);
+	void RemoveDependency(Gate* source, Gate* dependent);
+	void RemoveGate(Gate* gate);
+	void Clear();
 
-	//void ComputeAllGates(std::vector<Gate*>& gates);
+	std::vector<std::vector<Gate*>> Components(const std::vector<Gate*>& gates) const;
+	std::vector<std::vector<Gate*>> Levelize(const std::vector<Gate*>& gates) const;
+	std::vector<std::vector<Gate*>> FindLoops(const std::vector<Gate*>& gates) const;
 };
 
 
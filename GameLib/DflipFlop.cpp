@@ -5,6 +5,7 @@
 
 #include "pch.h"
 #include "DflipFlop.h"
+#include "Game.h"
 
 
 using namespace std;
@@ -42,19 +43,19 @@ const int Add42 = 42;
 
 DflipFlop::DflipFlop(Game* game) : Gate(game)
 {
-	auto inputPin1 = make_shared<Pin>(game, PinType::INPUT, -(mSize.GetWidth() * Input) + Input1Const,
+	auto inputPin1 = game->MakePin(PinType::INPUT, -(mSize.GetWidth() * Input) + Input1Const,
 									-(mSize.GetHeight() * Mul4) + Add35);
-	auto inputPin2 = make_shared<Pin>(game, PinType::INPUT, -mSize.GetWidth() * Input + Input2Const,
+	auto inputPin2 = game->MakePin(PinType::INPUT, -mSize.GetWidth() * Input + Input2Const,
 									mSize.GetHeight() * Mul4 + Add42);
-	auto outputPin1 = make_shared<Pin>(game, PinType::OUTPUT, mSize.GetWidth(),
+	auto outputPin1 = game->MakePin(PinType::OUTPUT, mSize.GetWidth(),
 										-mSize.GetHeight() * Mul4 + Add35, PinState::ZERO);
-	auto outputPin2 = make_shared<Pin>(game, PinType::OUTPUT, mSize.GetWidth(),
+	auto outputPin2 = game->MakePin(PinType::OUTPUT, mSize.GetWidth(),
 										mSize.GetHeight() * Mul4 + Add42, PinState::ONE);
 
-	mPins.push_back(inputPin1);
-	mPins.push_back(inputPin2);
-	mPins.push_back(outputPin1);
-	mPins.push_back(outputPin2);
+	AddPin(inputPin1);
+	AddPin(inputPin2);
+	AddPin(outputPin1);
+	AddPin(outputPin2);
 }
 
 
@@ -104,39 +105,72 @@ void DflipFlop::Draw(std::shared_ptr<wxGraphicsContext> gc)
 
 /**
  * Decides the output state of the gate
+ *
+ * Samples the inputs and commits the result in one step
  */
 void DflipFlop::calculate()
 {
-	vector<shared_ptr<Pin>> InputPins = GetInputPins();
-	vector<shared_ptr<Pin>> OutputPins = GetOutputPins();
+	Sample();
+	Commit();
+}
 
-	if (InputPins.size() > 1 && InputPins[0] && InputPins[1] &&
-		OutputPins.size() > 1 && OutputPins[0] && OutputPins[1])
-	{
+/**
+ * Latch D if the clock rose since the last sample
+ */
+void DflipFlop::Sample()
+{
+	PinSpan InputPins = GetInputPins();
 
+	if (InputPins.size() > 1 && InputPins[0] && InputPins[1])
+	{
 		PinState D = InputPins[0]->GetState();
 		PinState Clk = InputPins[1]->GetState();
 
-		shared_ptr<Pin> Output_Q = OutputPins[0];
-		shared_ptr<Pin> Output_Q_Bar = OutputPins[1];
-
-		PinState tempQState = D;
-		PinState tempQBarState = (D == PinState::ONE) ? PinState::ZERO : PinState::ONE;
-
-
 		if (mPrevClkState == PinState::ZERO && Clk == PinState::ONE)
 		{
-			mLastQState = tempQState;
-			mLastQBarState = tempQBarState;
+			mLastQState = D;
+			mLastQBarState = (D == PinState::ONE) ? PinState::ZERO : PinState::ONE;
 		}
 
-		SetOutput(Output_Q, mLastQState);
-		SetOutput(Output_Q_Bar, mLastQBarState);
-
 		mPrevClkState = Clk;
 	}
 }
 
+/**
+ * Drive Q and Q' from the latched state
+ */
+void DflipFlop::Commit()
+{
+	PinSpan OutputPins = GetOutputPins();
+
+	if (OutputPins.size() > 1 && OutputPins[0] && OutputPins[1])
+	{
+		SetOutput(OutputPins[0], mLastQState);
+		SetOutput(OutputPins[1], mLastQBarState);
+	}
+}
+
+/**
+ * Copy the remembered states of the flip flop out
+ * @param memory Array of the last clock, Q and Q' states to fill
+ */
+void DflipFlop::GetMemory(PinState* memory) const
+{
+	memory[0] = mPrevClkState;
+	memory[1] = mLastQState;
+	memory[2] = mLastQBarState;
+}
+
+/**
+ * Replace the remembered states of the flip flop
+ * @param memory Array of the last clock, Q and Q' states
+ */
+void DflipFlop::SetMemory(const PinState* memory)
+{
+	mPrevClkState = memory[0];
+	mLastQState = memory[1];
+	mLastQBarState = memory[2];
+}
 
 /**
  * Updates the D Flip Flop gate, adjusting the absolute positions of its pins.
@@ -52,6 +52,35 @@ public:
 	const wxSize GetSize() override { return mSize; };
 
 	void calculate() override;
+
+	/**
+	 * Get the logic function of this gate
+	 * @return GateOp::DFlipFlop
+	 */
+	GateOp GetOp() const override { return GateOp::DFlipFlop; }
+
+	/**
+	 * Get the propagation delay of this gate
+	 * @return 3 time units
+	 */
+	int GetDelay() const override { return 3; }
+
+	/**
+	 * The flip flop remembers the last clock, Q and Q' states
+	 * @return 3
+	 */
+	int GetMemorySize() const override { return 3; }
+
+	/**
+	 * The flip flop latches D on a rising clock edge
+	 * @return true
+	 */
+	bool IsSequential() const override { return true; }
+
+	void Sample() override;
+	void Commit() override;
+	void GetMemory(PinState* memory) const override;
+	void SetMemory(const PinState* memory) override;
 	void Update(double elapsed) override;
 };
 
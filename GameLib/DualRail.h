@@ -0,0 +1,178 @@
+/**
+ * @file DualRail.h
+ * @author Ethan Springer, Daksh Mehta, Sehaj Gupta, Lukas Schaefer, Jack McNamara
+ *
+ * Three valued pin states packed 64 to a word
+ */
+
+#ifndef DUALRAIL_H
+#define DUALRAIL_H
+
+#include <cstdint>
+#include "Pin.h"
+
+/**
+ * 64 independent pin states packed into two bit planes.
+ *
+ * Bit i of known is set if lane i is ZERO or ONE, and bit i
+ * of value is then its state. Unknown lanes always have a
+ * value bit of zero, so two words compare equal exactly
+ * when every lane has the same PinState.
+ *
+ * The gate kernels below follow the gates: any unknown input
+ * makes the output unknown. They are branch free, so each
+ * one evaluates 64 input vectors in a handful of instructions.
+ */
+struct DualRail
+{
+    /// Lane values, only meaningful where known is set
+    uint64_t value = 0;
+    /// Lanes that are ZERO or ONE
+    uint64_t known = 0;
+
+    /**
+     * Set every lane to the same state
+     * @param state State for all 64 lanes
+     * @return The packed states
+     */
+    static DualRail Broadcast(PinState state)
+    {
+        DualRail rail;
+        rail.known = state == PinState::UNKNOWN ? 0 : ~uint64_t(0);
+        rail.value = state == PinState::ONE ? ~uint64_t(0) : 0;
+        return rail;
+    }
+
+    /**
+     * Get the state of one lane
+     * @param lane Lane number, 0 to 63
+     * @return The state of that lane
+     */
+    PinState Get(int lane) const
+    {
+        uint64_t bit = uint64_t(1) << lane;
+        if (!(known & bit))
+        {
+            return PinState::UNKNOWN;
+        }
+        return (value & bit) ? PinState::ONE : PinState::ZERO;
+    }
+
+    /**
+     * Set the state of one lane
+     * @param lane Lane number, 0 to 63
+     * @param state New state of that lane
+     */
+    void Set(int lane, PinState state)
+    {
+        uint64_t bit = uint64_t(1) << lane;
+        known = state == PinState::UNKNOWN ? known & ~bit : known | bit;
+        value = state == PinState::ONE ? value | bit : value & ~bit;
+    }
+
+    /**
+     * Are two words the same in every lane
+     * @param other Word to compare with
+     * @return True if equal
+     */
+    bool operator==(const DualRail& other) const { return value == other.value && known == other.known; }
+};
+
+/**
+ * AND of two inputs
+ * @param a First input
+ * @param b Second input
+ * @return Unknown where either input is, otherwise a AND b
+ */
+inline DualRail DualAnd(DualRail a, DualRail b)
+{
+    DualRail out;
+    out.known = a.known & b.known;
+    out.value = a.value & b.value & out.known;
+    return out;
+}
+
+/**
+ * OR of two inputs
+ * @param a First input
+ * @param b Second input
+ * @return Unknown where either input is, otherwise a OR b
+ */
+inline DualRail DualOr(DualRail a, DualRail b)
+{
+    DualRail out;
+    out.known = a.known & b.known;
+    out.value = (a.value | b.value) & out.known;
+    return out;
+}
+
+/**
+ * Invert an input
+ * @param a Input
+ * @return Unknown where a is, otherwise NOT a
+ */
+inline DualRail DualNot(DualRail a)
+{
+    DualRail out;
+    out.known = a.known;
+    out.value = ~a.value & a.known;
+    return out;
+}
+
+/**
+ * NAND of two inputs
+ * @param a First input
+ * @param b Second input
+ * @return Unknown where either input is, otherwise a NAND b
+ */
+inline DualRail DualNand(DualRail a, DualRail b)
+{
+    return DualNot(DualAnd(a, b));
+}
+
+/**
+ * Positive edge triggered D flip flop
+ *
+ * Q' is ONE whenever the sampled D is not ONE, the same as DflipFlop.
+ * @param d Data input
+ * @param clk Clock input
+ * @param prevClk Clock at the last step, updated to clk
+ * @param q Stored Q, updated on a rising edge
+ * @param qBar Stored Q', updated on a rising edge
+ */
+inline void DualDFlipFlop(DualRail d, DualRail clk, DualRail& prevClk, DualRail& q, DualRail& qBar)
+{
+    uint64_t edge = prevClk.known & ~prevClk.value & clk.known & clk.value;
+    uint64_t dIsOne = d.known & d.value;
+
+    q.known = (q.known & ~edge) | (d.known & edge);
+    q.value = (q.value & ~edge) | (d.value & edge);
+    qBar.known |= edge;
+    qBar.value = (qBar.value & ~edge) | (~dIsOne & edge);
+    prevClk = clk;
+}
+
+/**
+ * SR flip flop, holding its outputs while neither input is ONE
+ * @param s Set input
+ * @param r Reset input
+ * @param q Q output, updated in place
+ * @param qBar Q' output, updated in place
+ */
+inline void DualSRFlipFlop(DualRail s, DualRail r, DualRail& q, DualRail& qBar)
+{
+    uint64_t set = s.known & s.value;
+    uint64_t reset = r.known & r.value;
+    uint64_t onlySet = set & ~reset;
+    uint64_t onlyReset = reset & ~set;
+    uint64_t change = set | reset;
+
+    // Lanes with both set and reset become unknown
+    q.known = (q.known & ~change) | onlySet | onlyReset;
+    q.value = (q.value & ~change) | onlySet;
+    qBar.known = (qBar.known & ~change) | onlySet | onlyReset;
+    qBar.value = (qBar.value & ~change) | onlyReset;
+}
+
+
+#endif //DUALRAIL_H
@@ -6,15 +6,16 @@
 #include "pch.h"
 #include "Game.h"
 #include <algorithm>
+#include <limits>
 #include <utility>
 #include <memory>
 #include "Beam.h"
 #include "Conveyor.h"
-#include "ConveyorVisitor.h"
+#include "Product.h"
+#include "PropertyBox.h"
 #include "Scoreboard.h"
 #include "Sensor.h"
 #include "Sparty.h"
-#include "DependencyGraph.h"
 
 using namespace std;
 
@@ -53,6 +54,28 @@ Game::Game()
     mScore = std::make_shared<Score>();
 }
 
+/**
+ * Get the box around everything of a gate a click can hit
+ * @param gate The gate
+ * @return Bounds of the body of the gate and its pins
+ */
+static SpatialGrid::Bounds GateBounds(Gate* gate)
+{
+    double x = gate->GetX();
+    double y = gate->GetY();
+    double w = gate->GetSize().GetWidth();
+    double h = gate->GetSize().GetHeight();
+    SpatialGrid::Bounds bounds{x - w / 2, y - h / 2, x + w / 2, y + h / 2};
+    for (const auto& pin : gate->GetPins())
+    {
+        bounds.left = std::min(bounds.left, x + pin->GetRelativeX() - PinSize);
+        bounds.right = std::max(bounds.right, x + pin->GetRelativeX() + PinSize);
+        bounds.top = std::min(bounds.top, y + pin->GetRelativeY() - PinSize);
+        bounds.bottom = std::max(bounds.bottom, y + pin->GetRelativeY() + PinSize);
+    }
+    return bounds;
+}
+
 /**
  * Draw the game
  * @param graphics Graphics device to draw on
@@ -95,11 +118,26 @@ void Game::OnDraw(std::shared_ptr<wxGraphicsContext> graphics, int width, int he
     graphics->SetBrush(background);
     graphics->DrawRectangle(0, 0, pixelWidth, pixelHeight);
 
-    // Redraw all items
-    for (auto item : mItems)
+    // Redraw all items a layer at a time, in the order they are stacked
+    auto draw = [&graphics](Item* item) { item->Draw(graphics); };
+    auto drawWires = [&graphics](Item* item) { item->DrawWires(graphics); };
+    mLayers.ForEach(Layer::Conveyor, draw);
+    mLayers.ForEach(Layer::Machines, draw);
+    mLayers.ForEach(Layer::Gates, draw);
+
+    // Box the selected gates
+    graphics->SetBrush(*wxTRANSPARENT_BRUSH);
+    graphics->SetPen(wxPen(SelectionColor, 2));
+    for (Gate* gate : GetSelectedGates())
     {
-        item->Draw(graphics);
+        auto bounds = GateBounds(gate);
+        graphics->DrawRectangle(bounds.left, bounds.top, bounds.right - bounds.left, bounds.bottom - bounds.top);
     }
+
+    mLayers.ForEach(Layer::Machines, drawWires);
+    mLayers.ForEach(Layer::Gates, drawWires);
+    mLayers.ForEach(Layer::Overlay, draw);
+
     // Draws the notice if not in playing state
     if (mState != PLAYING)
     {
@@ -172,6 +210,19 @@ void Game::Add(std::shared_ptr<Item> item)
 {
     //item->SetLocation(InitialX, InitialY);
     mItems.push_back(item);
+    mLayers.Insert(item.get());
+    item->Accept(&mRegistry);
+
+    Gate* gate = item->AsGate();
+    if (gate)
+    {
+        mNetlist.AddGate(gate);
+        mGrid.Insert(item, GateBounds(gate));
+    }
+    else if (item->IsClickable())
+    {
+        mGrid.InsertEverywhere(item);
+    }
 }
 
 /**
@@ -281,7 +332,14 @@ void Game::NextLevel()
  */
 void Game::Clear()
 {
+    mNetlist.Clear();
+    mRegistry.Clear();
+    mGrid.Clear();
+    mProductStore.Clear();
+    mLayers.Clear();
+    mSelection.clear();
     mItems.clear();
+    mLevelArena.release();
 }
 
 /**
@@ -297,23 +355,23 @@ void Game::XmlItem(wxXmlNode* node)
     auto type = node->GetName();
     if (type == L"sensor")
     {
-        item = std::make_shared<Sensor>(this);
+        item = MakeLevelItem<Sensor>();
     }
     if (type == L"conveyor")
     {
-        item = std::make_shared<Conveyor>(this);
+        item = MakeLevelItem<Conveyor>();
     }
     if (type == L"beam")
     {
-        item = std::make_shared<Beam>(this);
+        item = MakeLevelItem<Beam>();
     }
     if (type == L"sparty")
     {
-        item = std::make_shared<Sparty>(this);
+        item = MakeLevelItem<Sparty>();
     }
     if (type == L"scoreboard")
     {
-        item = std::make_shared<Scoreboard>(this);
+        item = MakeLevelItem<Scoreboard>();
     }
 
 
@@ -359,11 +417,12 @@ std::shared_ptr<Item> Game::HitTest(int x, int y)
     {
         return nullptr;
     }
-    for (auto i = mItems.rbegin(); i != mItems.rend(); i++)
+    mGrid.Query(x, y, mHits);
+    for (auto& hit : mHits)
     {
-        if ((*i)->HitTest(x, y))
+        if (hit.item->HitTest(x, y))
         {
-            return *i;
+            return mGrid.Find(hit.item);
         }
     }
 
@@ -384,9 +443,10 @@ std::shared_ptr<Pin> Game::PinHitTest(int x, int y)
     {
         return nullptr;
     }
-    for (auto i = mItems.rbegin(); i != mItems.rend(); i++)
+    mGrid.Query(x, y, mHits);
+    for (auto& hit : mHits)
     {
-        auto pin = (*i)->PinHitTest(x, y);
+        auto pin = hit.item->PinHitTest(x, y);
         if (pin)
         {
             return pin;
@@ -397,16 +457,29 @@ std::shared_ptr<Pin> Game::PinHitTest(int x, int y)
 }
 
 /**
- * move item to end of Item list
- * @param item item to move to the end of mItems
+ * Bring an item to the top of its layer, so it is drawn
+ * and hit tested before the others in the layer
+ * @param item item to bring to the top
  */
 void Game::MoveBack(std::shared_ptr<Item> item)
 {
-    auto loc = find(begin(mItems), end(mItems), item);
-    if (loc != end(mItems))
+    mLayers.Raise(item.get());
+    mGrid.Raise(item.get());
+}
+
+/**
+ * Move an item to its new place in the hit testing grid
+ *
+ * Called by Item::SetLocation. Only gates are placed by bounds,
+ * the other items are tested wherever the click is.
+ * @param item The item that moved
+ */
+void Game::OnItemMoved(Item* item)
+{
+    Gate* gate = item->AsGate();
+    if (gate)
     {
-        mItems.erase(loc);
-        mItems.push_back(item);
+        mGrid.Move(gate, GateBounds(gate));
     }
 }
 
@@ -440,24 +513,139 @@ void Game::Update(double elapsed, bool always_update)
             return;
         }
     }
-    for (auto item : mItems)
+
+    // The logic runs in fixed ticks, which may be many per frame,
+    // so a beam or sensor pulse shorter than a frame still reaches
+    // the gates. Time left over carries into the next update.
+    mTickTime += elapsed;
+    double tick = 1.0 / mTickRate;
+    int ticks = int(mTickTime * mTickRate);
+    if (ticks > MaxTicksPerUpdate)
+    {
+        ticks = MaxTicksPerUpdate;
+        mTickTime = 0;
+    }
+    else
+    {
+        mTickTime -= ticks * tick;
+    }
+
+    for (int i = 0; i < ticks; i++)
+    {
+        UpdateSources(tick);
+        MoveProducts(tick);
+        ComputeAllGates();
+        mTicks++;
+    }
+
+    // With no time passed there is no whole tick, but a level that
+    // was just loaded still needs its products and pins put in place
+    if (ticks == 0 && (always_update || elapsed == 0))
     {
-        item->Update(elapsed);
+        UpdateSources(0);
+        MoveProducts(0);
+        ComputeAllGates();
     }
 
-    ComputeAllGates(mItems);
+    UpdateItems(elapsed);
 
 
     // Checks if the level is done
-    ConveyorVisitor visitor;
-    Accept(&visitor);
-    if (visitor.GetConveyor() != nullptr && visitor.GetConveyor()->IsLevelDone())
+    Conveyor* conveyor = mRegistry.GetConveyor();
+    if (conveyor != nullptr && conveyor->IsLevelDone())
     {
         mState = ENDING;
         mStateTime = LevelNoticeDuration;
     }
 }
 
+/**
+ * Update the items that drive the logic for one tick.
+ *
+ * The conveyor moves the belt the products follow, and the beams
+ * and sensors set the pins the gates read, so they are stepped
+ * with the gates and a product passing in less than a frame is
+ * still seen. Sparty checks its pin every tick too, so a kick
+ * pulse shorter than a frame is not lost. The items are updated a type at a time from the
+ * registry, and the item classes are final, so no virtual call
+ * is needed.
+ * @param elapsed Time since the last tick in seconds
+ */
+void Game::UpdateSources(double elapsed)
+{
+    Conveyor* conveyor = mRegistry.GetConveyor();
+    if (conveyor != nullptr)
+    {
+        conveyor->Update(elapsed);
+    }
+    for (Beam* beam : mRegistry.GetBeams())
+    {
+        beam->Update(elapsed);
+    }
+    for (Sensor* sensor : mRegistry.GetSensors())
+    {
+        sensor->Update(elapsed);
+    }
+    Sparty* sparty = mRegistry.GetSparty();
+    if (sparty != nullptr)
+    {
+        sparty->CheckKick();
+    }
+}
+
+/**
+ * Update the rest of the items once per frame.
+ *
+ * These only animate or place their pins, so they do not need
+ * to be stepped with the logic. Only the gates, which come in
+ * many kinds, need a virtual call. Products have nothing to
+ * update here, they are moved by MoveProducts.
+ * @param elapsed Time since the last frame in seconds
+ */
+void Game::UpdateItems(double elapsed)
+{
+    for (PropertyBox* box : mRegistry.GetPropertyBoxes())
+    {
+        box->Update(elapsed);
+    }
+    Sparty* sparty = mRegistry.GetSparty();
+    if (sparty != nullptr)
+    {
+        sparty->Update(elapsed);
+    }
+    for (Gate* gate : mRegistry.GetGates())
+    {
+        gate->Update(elapsed);
+    }
+}
+
+/**
+ * Move every product for one tick.
+ *
+ * Products on the belt follow the conveyor and kicked products
+ * move off it, all in one pass over the product store. A product
+ * still on the belt that passes Sparty without being kicked scores.
+ * @param elapsed Time since the last tick in seconds
+ */
+void Game::MoveProducts(double elapsed)
+{
+    Conveyor* conveyor = mRegistry.GetConveyor();
+    double belt = conveyor != nullptr ? conveyor->GetOffset() : 0;
+
+    Sparty* sparty = mRegistry.GetSparty();
+    double kickLine = std::numeric_limits<double>::infinity();
+    if (sparty != nullptr)
+    {
+        kickLine = sparty->GetKickY() + ProductDefaultSize / 2;
+    }
+
+    mProductStore.Update(elapsed, belt, kickLine);
+    for (size_t slot : mProductStore.GetPassed())
+    {
+        mScore->UpdateLevelScore(!mProductStore.ShouldKick(slot));
+    }
+}
+
 /**
  * Accept a visitor for all items in the game.
  *
@@ -469,35 +657,105 @@ void Game::Update(double elapsed, bool always_update)
  */
 void Game::Accept(ItemVisitor* visitor)
 {
-    for (auto item : mItems)
+    for (const auto& item : mItems)
     {
         item->Accept(visitor);
     }
 }
 
 /**
- * Sorts the gates and computes their outputs
- * @param items a vector of items(similar to mItems in some classes)
+ * Accept a visitor for the products in the game only
+ * @param visitor Pointer to the ItemVisitor to be used
  */
-void Game::ComputeAllGates(const vector<shared_ptr<Item>>& items)
+void Game::AcceptProducts(ItemVisitor* visitor)
 {
-    std::vector<Gate*> gates;
+    for (Product* product : mRegistry.GetProducts())
+    {
+        product->Accept(visitor);
+    }
+}
 
-    for (const auto item : items)
+/**
+ * Accept a visitor for the products near a y location.
+ *
+ * The conveyor finds its products by a binary search, so only
+ * the products close to y are visited. The visitor should still
+ * check the location, as some a little out of range can be visited.
+ * @param y Y location to search around
+ * @param range Size of the search
+ * @param visitor Pointer to the ItemVisitor to be used
+ */
+void Game::AcceptProducts(double y, double range, ItemVisitor* visitor)
+{
+    Conveyor* conveyor = mRegistry.GetConveyor();
+    if (conveyor == nullptr)
     {
-        Gate* gate = item->AsGate();
-        if (gate)
-        {
-            gates.push_back(gate);
-        }
+        AcceptProducts(visitor);
+        return;
+    }
+    conveyor->AcceptProducts(y, range, visitor);
+}
+
+/**
+ * Computes the outputs of all the gates for one logic tick.
+ *
+ * The evaluation order is cached by the netlist and only
+ * recomputed after the wiring changes.
+ */
+void Game::ComputeAllGates()
+{
+    mNetlist.Evaluate();
+}
+
+/**
+ * Set how many logic ticks run per second of game time
+ * @param rate Ticks per second, must be positive
+ */
+void Game::SetTickRate(double rate)
+{
+    if (rate > 0)
+    {
+        mTickRate = rate;
+        mTickTime = 0;
+    }
+}
+
+/**
+ * Select a gate, or deselect it if it is already selected
+ * @param item Item clicked on, ignored if it is not a gate
+ */
+void Game::ToggleSelected(Item* item)
+{
+    if (item->AsGate() == nullptr)
+    {
+        return;
     }
 
-    DependencyGraph depGraph;
-    depGraph.BuildDependencyGraph(gates);
-    std::vector<Gate*> sortedGates = depGraph.TopologicalSort(gates);
+    auto found = find(mSelection.begin(), mSelection.end(), item->GetHandle());
+    if (found != mSelection.end())
+    {
+        mSelection.erase(found);
+    }
+    else
+    {
+        mSelection.push_back(item->GetHandle());
+    }
+}
 
-    for (Gate* gate : sortedGates)
+/**
+ * Get the gates the player has selected
+ * @return The selected gates that still exist, in the order they were selected
+ */
+std::vector<Gate*> Game::GetSelectedGates() const
+{
+    std::vector<Gate*> gates;
+    for (const Handle& handle : mSelection)
     {
-        gate->calculate();
+        Item* item = GetItem(handle);
+        if (item != nullptr)
+        {
+            gates.push_back(item->AsGate());
+        }
     }
+    return gates;
 }
@@ -10,11 +10,17 @@
 
 #include <complex.h>
 #include <memory>
+#include <memory_resource>
 #include <wx/graphics.h>
 
 #include "Gate.h"
 #include "Item.h"
+#include "ItemRegistry.h"
+#include "Netlist.h"
+#include "ProductStore.h"
+#include "RenderLayers.h"
 #include "Score.h"
+#include "SpatialGrid.h"
 #include <vector>
 
 /// Color to use for "green"
@@ -35,12 +41,34 @@ const wxColour LevelNoticeBackground = wxColour(255, 255, 255, 200);
 /// Padding to add to the left and right side of the level
 /// notice background rectangle in virtual pixels
 const double LevelNoticePadding = 20;
+
+/// Color of the box drawn around a selected gate
+const wxColour SelectionColor = wxColour(255, 165, 0);
+
+/// Default number of logic ticks per second
+const double DefaultTickRate = 1000;
+
+/// Most logic ticks one update runs, so after a stall the
+/// game slows down instead of trying to catch up
+const int MaxTicksPerUpdate = 256;
 /**
 * Base class for the game itself
 */
 class Game
 {
 private:
+    /// Handles of every item and pin made for the game. Declared
+    /// first so it outlives the items, which remove themselves.
+    HandlePool<Item> mHandles;
+
+    /// Memory for the items loaded with a level, released all at
+    /// once by Clear. Declared before mItems so it outlives them.
+    std::pmr::monotonic_buffer_resource mLevelArena;
+
+    /// Memory for the gates the player adds and for pins, which is
+    /// reused as they are destroyed
+    std::pmr::unsynchronized_pool_resource mGatePool;
+
     /// frame scale for virtual pixels
     double mScale;
 
@@ -50,9 +78,30 @@ private:
     /// offset amount for y position for virtual pixels
     double mYOffset;
 
+    /// The wiring of the gates in the game
+    Netlist mNetlist;
+
     /// All items to populate our game
     std::vector<std::shared_ptr<Item>> mItems;
 
+    /// The items of mItems sorted by type
+    ItemRegistry mRegistry;
+
+    /// The items of mItems by where they are, for hit testing
+    SpatialGrid mGrid;
+
+    /// The items of mItems in the order they are drawn
+    RenderLayers mLayers;
+
+    /// Handles of the gates the player has selected
+    std::vector<Handle> mSelection;
+
+    /// Items that may be hit by the click being tested
+    std::vector<SpatialGrid::Entry> mHits;
+
+    /// The offsets and kicks of the products, moved together each tick
+    ProductStore mProductStore;
+
     /// The initial size of the game x value
     double mXInitialSize;
 
@@ -76,6 +125,19 @@ private:
     /// Bool to  check if control points are on or off
     bool mControlPoints = false;
 
+    /// Logic ticks per second
+    double mTickRate = DefaultTickRate;
+
+    /// Time not yet used up by a whole tick
+    double mTickTime = 0;
+
+    /// Number of ticks run since the game was created
+    long long mTicks = 0;
+
+    void UpdateSources(double elapsed);
+    void UpdateItems(double elapsed);
+    void MoveProducts(double elapsed);
+
 public:
     /// Constructor
     Game();
@@ -99,6 +161,7 @@ public:
     std::shared_ptr<Item> HitTest(int x, int y);
     std::shared_ptr<Pin> PinHitTest(int x, int y);
     void MoveBack(std::shared_ptr<Item> item);
+    void OnItemMoved(Item* item);
 
     /**
      * Getter for XOffset
@@ -122,8 +185,116 @@ public:
     void Update(double elapsed, bool always_update=false);
 
     void Accept(ItemVisitor* visitor);
+    void AcceptProducts(ItemVisitor* visitor);
+    void AcceptProducts(double y, double range, ItemVisitor* visitor);
+
+    /**
+     * Get the items of the game sorted by type
+     * @return The registry, kept up to date by Add and Clear
+     */
+    const ItemRegistry& GetRegistry() const { return mRegistry; }
+
+    void ComputeAllGates();
+
+    /**
+     * Get the offsets and kicks of the products
+     * @return The product store, cleared by Clear
+     */
+    ProductStore& GetProductStore() { return mProductStore; }
+
+    /**
+     * Make an item that is part of the level being loaded.
+     *
+     * The item and its reference count are allocated together from
+     * the level arena, which Clear releases, so nothing may keep the
+     * item after the level is cleared.
+     * @tparam T Type of the item
+     * @param args Constructor arguments after the game
+     * @return The new item
+     */
+    template <class T, class... Args>
+    std::shared_ptr<T> MakeLevelItem(Args&&... args)
+    {
+        return std::allocate_shared<T>(std::pmr::polymorphic_allocator<T>(&mLevelArena), this,
+                                       std::forward<Args>(args)...);
+    }
+
+    /**
+     * Make a gate the player is adding.
+     *
+     * The gate is allocated from a pool that reuses the memory of
+     * gates that have been destroyed.
+     * @tparam T Type of the gate
+     * @param args Constructor arguments after the game
+     * @return The new gate
+     */
+    template <class T, class... Args>
+    std::shared_ptr<T> MakeGate(Args&&... args)
+    {
+        return std::allocate_shared<T>(std::pmr::polymorphic_allocator<T>(&mGatePool), this,
+                                       std::forward<Args>(args)...);
+    }
+
+    /**
+     * Make a pin for a gate or another item of the game
+     * @param args Constructor arguments after the game
+     * @return The new pin, allocated from the same pool as gates
+     */
+    template <class... Args>
+    std::shared_ptr<Pin> MakePin(Args&&... args)
+    {
+        return std::allocate_shared<Pin>(std::pmr::polymorphic_allocator<Pin>(&mGatePool), this,
+                                         std::forward<Args>(args)...);
+    }
+
+    /**
+     * Get the handles of the items and pins of the game
+     * @return Pool every item adds itself to when it is made
+     */
+    HandlePool<Item>& GetHandles() { return mHandles; }
+
+    /**
+     * Find an item or pin by its handle
+     * @param handle Handle from Item::GetHandle
+     * @return The item, nullptr if it has been destroyed
+     */
+    Item* GetItem(Handle handle) const { return mHandles.Get(handle); }
+
+    /**
+     * Get the grid the items are hit tested from
+     * @return The grid of the clickable items
+     */
+    const SpatialGrid& GetGrid() const { return mGrid; }
 
-    void ComputeAllGates(const std::vector<std::shared_ptr<Item>>& items);
+    void ToggleSelected(Item* item);
+    std::vector<Gate*> GetSelectedGates() const;
+
+    /**
+     * Deselect every gate
+     */
+    void ClearSelection() { mSelection.clear(); }
+
+    void SetTickRate(double rate);
+
+    /**
+     * Get the number of logic ticks per second
+     * @return The tick rate in Hz
+     */
+    double GetTickRate() const { return mTickRate; }
+
+    /**
+     * Get the number of logic ticks run so far
+     * @return Ticks since the game was created
+     */
+    long long GetTicks() const { return mTicks; }
+
+    /**
+     * Get the wiring of the gates in the game
+     *
+     * Pins report wires being connected and disconnected here
+     * @return Pointer to the netlist
+     */
+    Netlist* GetNetlist() { return &mNetlist; }
 
     /**
      * Gets the current score object
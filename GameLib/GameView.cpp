@@ -17,6 +17,8 @@
 #include "MainFrame.h"
 #include "Scoreboard.h"
 #include "NotGate.h"
+#include "ClockGate.h"
+#include "MacroGate.h"
 #include "SRFlipFlop.h"
 
 
@@ -80,6 +82,25 @@ void GameView::Initialize(wxFrame* parent)
     parent->Bind(wxEVT_COMMAND_MENU_SELECTED, &GameView::OnAddDflipFlop, this, IDM_ADDDFLIPFLOP);
     parent->Bind(wxEVT_COMMAND_MENU_SELECTED, &GameView::OnAddSRFlipFlop, this, IDM_ADDSRFLIPFLOP);
     parent->Bind(wxEVT_COMMAND_MENU_SELECTED, &GameView::OnAddNandGate, this, IDM_ADDNANDGATE);
+    // Wide gate handlers
+    parent->Bind(wxEVT_COMMAND_MENU_SELECTED, [this](wxCommandEvent& event) { OnAddGate(mGame.MakeGate<AndGate3>()); }, IDM_ADDANDGATE3);
+    parent->Bind(wxEVT_COMMAND_MENU_SELECTED, [this](wxCommandEvent& event) { OnAddGate(mGame.MakeGate<AndGate4>()); }, IDM_ADDANDGATE4);
+    parent->Bind(wxEVT_COMMAND_MENU_SELECTED, [this](wxCommandEvent& event) { OnAddGate(mGame.MakeGate<AndGate8>()); }, IDM_ADDANDGATE8);
+    parent->Bind(wxEVT_COMMAND_MENU_SELECTED, [this](wxCommandEvent& event) { OnAddGate(mGame.MakeGate<OrGate3>()); }, IDM_ADDORGATE3);
+    parent->Bind(wxEVT_COMMAND_MENU_SELECTED, [this](wxCommandEvent& event) { OnAddGate(mGame.MakeGate<OrGate4>()); }, IDM_ADDORGATE4);
+    parent->Bind(wxEVT_COMMAND_MENU_SELECTED, [this](wxCommandEvent& event) { OnAddGate(mGame.MakeGate<OrGate8>()); }, IDM_ADDORGATE8);
+    parent->Bind(wxEVT_COMMAND_MENU_SELECTED, [this](wxCommandEvent& event) { OnAddGate(mGame.MakeGate<NandGate3>()); }, IDM_ADDNANDGATE3);
+    parent->Bind(wxEVT_COMMAND_MENU_SELECTED, [this](wxCommandEvent& event) { OnAddGate(mGame.MakeGate<NandGate4>()); }, IDM_ADDNANDGATE4);
+    parent->Bind(wxEVT_COMMAND_MENU_SELECTED, [this](wxCommandEvent& event) { OnAddGate(mGame.MakeGate<NandGate8>()); }, IDM_ADDNANDGATE8);
+    parent->Bind(wxEVT_COMMAND_MENU_SELECTED, [this](wxCommandEvent& event) { OnAddGate(mGame.MakeGate<ClockGate>()); }, IDM_ADDCLOCK);
+    parent->Bind(wxEVT_COMMAND_MENU_SELECTED, &GameView::OnPackageGates, this, IDM_PACKAGEGATES);
+    parent->Bind(wxEVT_COMMAND_MENU_SELECTED, [this](wxCommandEvent& event)
+    {
+        if (mPackage)
+        {
+            OnAddGate(mGame.MakeGate<MacroGate>(mPackage));
+        }
+    }, IDM_ADDPACKAGE);
     // Level loading handlers
     parent->Bind(wxEVT_COMMAND_MENU_SELECTED, [this](wxCommandEvent& event) { OnLevelLoad(event, 0); }, IDM_LEVEL_0);
     parent->Bind(wxEVT_COMMAND_MENU_SELECTED, [this](wxCommandEvent& event) { OnLevelLoad(event, 1); }, IDM_LEVEL_1);
@@ -96,6 +117,9 @@ void GameView::Initialize(wxFrame* parent)
     // bind control points toggle
     parent->Bind(wxEVT_COMMAND_MENU_SELECTED, &GameView::OnToggleControl, this, IDM_CONTROL_POINTS);
 
+    // Skip gates the player left lying around unwired
+    mGame.GetNetlist()->SetOptimize(true);
+
     // Default starting level is level 1
     mGame.Load(1);
 
@@ -146,10 +170,17 @@ void GameView::OnPaint(wxPaintEvent& event)
 void GameView::OnLeftDown(wxMouseEvent& event)
 {
     std::pair<double, double> cord = mGame.OnLeftDown((event.GetX()), event.GetY());
-    mGrabbedItem = mGame.HitTest(cord.first, cord.second);
-    if (mGrabbedItem != nullptr)
+    auto item = mGame.HitTest(cord.first, cord.second);
+    mGrabbedItem = Handle();
+    if (item != nullptr)
     {
-        mGame.MoveBack(mGrabbedItem);
+        // Shift-click picks the gates to package
+        if (event.ShiftDown())
+        {
+            mGame.ToggleSelected(item.get());
+        }
+        mGrabbedItem = item->GetHandle();
+        mGame.MoveBack(item);
         Refresh();
     }
 }
@@ -169,22 +200,24 @@ void GameView::OnLeftUp(wxMouseEvent& event)
 */
 void GameView::OnMouseMove(wxMouseEvent& event)
 {
-    // See if an item is currently being moved by the mouse
-    if (mGrabbedItem != nullptr)
+    // See if an item is currently being moved by the mouse.
+    // It is gone if the level changed while it was held.
+    Item* grabbed = mGame.GetItem(mGrabbedItem);
+    if (grabbed != nullptr)
     {
         // If an item is being moved, we only continue to
         // move it while the left button is down.
         if (event.LeftIsDown())
         {
             std::pair<double, double> cord = mGame.OnLeftDown((event.GetX()), event.GetY());
-            mGrabbedItem->SetLocation(cord.first, cord.second);
+            grabbed->SetLocation(cord.first, cord.second);
         }
         else
         {
             // When the left button is released, we release the
             // item.
-            mGrabbedItem->Release();
-            mGrabbedItem = nullptr;
+            grabbed->Release();
+            mGrabbedItem = Handle();
         }
 
         // Force the screen to redraw
@@ -208,7 +241,7 @@ void GameView::OnSize(wxSizeEvent& event)
  */
 void GameView::OnAddAndGate(wxCommandEvent& event)
 {
-    auto gate = make_shared<AndGate>(&mGame);
+    auto gate = mGame.MakeGate<AndGate>();
     mGame.Add(gate);
     Refresh();
 }
@@ -219,7 +252,7 @@ void GameView::OnAddAndGate(wxCommandEvent& event)
  */
 void GameView::OnAddOrGate(wxCommandEvent& event)
 {
-    auto gate = make_shared<OrGate>(&mGame);
+    auto gate = mGame.MakeGate<OrGate>();
     mGame.Add(gate);
     Refresh();
 }
@@ -230,7 +263,7 @@ void GameView::OnAddOrGate(wxCommandEvent& event)
 	*/
 void GameView::OnAddNotGate(wxCommandEvent& event)
 {
-    auto gate = make_shared<NotGate>(&mGame);
+    auto gate = mGame.MakeGate<NotGate>();
     mGame.Add(gate);
     Refresh();
 }
@@ -241,7 +274,7 @@ void GameView::OnAddNotGate(wxCommandEvent& event)
  */
 void GameView::OnAddDflipFlop(wxCommandEvent& event)
 {
-    auto gate = make_shared<DflipFlop>(&mGame);
+    auto gate = mGame.MakeGate<DflipFlop>();
     mGame.Add(gate);
     Refresh();
 }
@@ -252,7 +285,7 @@ void GameView::OnAddDflipFlop(wxCommandEvent& event)
  */
 void GameView::OnAddSRFlipFlop(wxCommandEvent& event)
 {
-    auto gate = make_shared<SRFlipFlop>(&mGame);
+    auto gate = mGame.MakeGate<SRFlipFlop>();
     mGame.Add(gate);
     Refresh();
 }
@@ -298,11 +331,46 @@ void GameView::OnClose(wxCloseEvent& event)
  */
 void GameView::OnAddNandGate(wxCommandEvent& event)
 {
-    auto gate = make_shared<NandGate>(&mGame);
+    auto gate = mGame.MakeGate<NandGate>();
+    mGame.Add(gate);
+    Refresh();
+}
+
+/**
+ * Add a gate chosen from the Wide gates menu
+ * @param gate The new gate
+ */
+void GameView::OnAddGate(std::shared_ptr<Item> gate)
+{
     mGame.Add(gate);
     Refresh();
 }
 
+/**
+ * Package the gates the player shift-clicked so instances
+ * of them can be added with the Add package menu option
+ * @param event menu event
+ */
+void GameView::OnPackageGates(wxCommandEvent& event)
+{
+    auto gates = mGame.GetSelectedGates();
+    if (gates.empty())
+    {
+        wxMessageBox(L"Shift-click the gates to package first");
+        return;
+    }
+
+    auto package = MacroDefinition::Package(gates);
+    if (package == nullptr)
+    {
+        wxMessageBox(L"Only gates without clocks, feedback loops or packages can be packaged");
+        return;
+    }
+    mPackage = package;
+    mGame.ClearSelection();
+    Refresh();
+}
+
 /**
  * function to toggle on/off control points when user selects to do so
  * @param event mouse event
@@ -9,6 +9,7 @@
 #define GAMEVIEW_H
 
 #include "Game.h"
+#include "MacroDefinition.h"
 
 /**
  * Base class for the viewing window
@@ -30,14 +31,16 @@ private:
 	void OnAddDflipFlop(wxCommandEvent& event);
 	void OnAddSRFlipFlop(wxCommandEvent& event);
 	void OnAddNandGate(wxCommandEvent& event);
+	void OnAddGate(std::shared_ptr<Item> gate);
+	void OnPackageGates(wxCommandEvent& event);
     void OnToggleControl(wxCommandEvent& event);
     void OnLevelLoad(wxCommandEvent& event, int level);
 
 	/// An object that describes our game
     Game mGame;
 
-    /// A pointer to an item that has been grabbed
-    std::shared_ptr<Item> mGrabbedItem;
+    /// Handle of an item that has been grabbed, null if none
+    Handle mGrabbedItem;
 
 
 	/// The timer that allows for animation
@@ -52,6 +55,9 @@ private:
 	/// Bool for ensuring the control points are
 	bool mControlPointsOn = false;
 
+	/// The gates packaged by the Package gates menu option
+	std::shared_ptr<MacroDefinition> mPackage;
+
 
 public:
     /// Initialize
@@ -5,9 +5,41 @@
 
 #include "pch.h"
 #include "Gate.h"
+#include "Netlist.h"
 
 using namespace std;
 
+/// Number of gates that have been constructed and not destroyed
+static size_t LiveGates = 0;
+
+/**
+ * Constructor
+ * @param game the game object
+ */
+Gate::Gate(Game* game) : Item(game)
+{
+    LiveGates++;
+}
+
+/**
+ * Destructor
+ *
+ * Takes the gate out of its netlist and detaches its pins,
+ * which may still be held elsewhere after the gate is gone
+ */
+Gate::~Gate()
+{
+    LiveGates--;
+    if (mNetlist)
+    {
+        mNetlist->RemoveGate(this);
+    }
+    for (const auto& pin : mPins)
+    {
+        pin->setSourceGate(nullptr);
+    }
+}
+
 /**
  *
  * @param x x coordinate of mouse click
@@ -26,49 +58,56 @@ bool Gate::HitTest(int x, int y)
 }
 
 /**
- * Getter for input pins only
- * @return input pins for the gate
+ * Add a pin to this gate and mark the gate as the pin's owner
+ * @param pin Pin to add
  */
-std::vector<std::shared_ptr<Pin>> Gate::GetInputPins()
+void Gate::AddPin(std::shared_ptr<Pin> pin)
 {
-    std::vector<std::shared_ptr<Pin>> inputPins;
-    for (const auto pin : mPins)
+    pin->setSourceGate(this);
+    mPins.push_back(pin);
+    if (pin->GetType() == PinType::INPUT)
     {
-        if (pin->GetType() == PinType::INPUT)
-        {
-            inputPins.push_back(pin);
-        }
+        mInputPins.push_back(pin);
+    }
+    else
+    {
+        mOutputPins.push_back(pin);
     }
-    return inputPins;
 }
 
 /**
- * Getter for output pin only
- * @return output pin for the gate
+ * Setter for output Pin
+ * @param pin The Pin to set
+ * @param state The State for Output
  */
-std::vector<std::shared_ptr<Pin>> Gate::GetOutputPins()
+void Gate::SetOutput(const shared_ptr<Pin>& pin, PinState state)
 {
-    std::vector<std::shared_ptr<Pin>> outputPins;
-    for (const auto pin : mPins)
+    if (!pin)
     {
-        if (pin->GetType() == PinType::OUTPUT)
-        {
-            outputPins.push_back(pin);
-        }
+        return;
+    }
+
+    // In timed mode the change reaches the pin after the gate's delay
+    if (mNetlist && mNetlist->GetMode() == Netlist::EvaluationMode::Timed)
+    {
+        mNetlist->ScheduleOutput(pin.get(), state, GetDelay());
+    }
+    else
+    {
+        pin->SetState(state);
     }
-    return outputPins;
 }
 
 /**
- * Setter for output Pin
- * @param pin The Pin to set
- * @param state The State for Output
+ * Called by an input pin of this gate when its state changes.
+ *
+ * Tells the netlist this gate needs to be calculated again.
  */
-void Gate::SetOutput(shared_ptr<Pin>& pin, PinState state)
+void Gate::OnInputChanged()
 {
-    if (pin)
+    if (mNetlist)
     {
-        pin->SetState(state);
+        mNetlist->MarkDirty(this);
     }
 }
 
@@ -80,7 +119,7 @@ void Gate::SetOutput(shared_ptr<Pin>& pin, PinState state)
 */
 std::shared_ptr<Pin> Gate::PinHitTest(int x, int y)
 {
-    for (const auto pin : mPins)
+    for (const auto& pin : mPins)
     {
         if (pin->HitTest(x, y))
         {
@@ -90,19 +129,38 @@ std::shared_ptr<Pin> Gate::PinHitTest(int x, int y)
     return nullptr;
 }
 
+/**
+ * Draw the wires from the output pins of this gate
+ * @param graphics gc context to draw on
+ */
+void Gate::DrawWires(std::shared_ptr<wxGraphicsContext> graphics)
+{
+    for (const auto& pin : mOutputPins)
+    {
+        pin->DrawWires(graphics);
+    }
+}
+
 /**
  * Updates the absolute positions of all pins in this gate
+ *
+ * The outputs are computed by the netlist, not here
  * @param elapsed time since last update
  */
 void Gate::Update(double elapsed)
 {
-    this->calculate();
-    for (auto pin : mPins)
+    for (const auto& pin : mPins)
     {
         pin->UpdateGatePosition(GetX(), GetY());
-        if(pin->GetType() ==PinType::OUTPUT)
-        {
-            pin->Update();
-        }
     }
 }
+
+/**
+ * Get the number of gates that exist, to check gates
+ * are freed when a level is cleared
+ * @return Gates constructed and not yet destroyed
+ */
+size_t Gate::GetLiveCount()
+{
+    return LiveGates;
+}
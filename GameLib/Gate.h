@@ -11,14 +11,35 @@
 #define GATE_H
 
 #include "Item.h"
+#include "ItemVisitor.h"
 #include "Pin.h"
+#include "PinSpan.h"
 #include <vector>
 
 /// Define the states of the gates
 enum GateState { LOW = 0, HIGH = 1, UNKNOWN = -1, INVALID = -2 };
 
+/// The logic function a gate computes, used when compiling a circuit
+enum class GateOp { And, Or, Nand, Not, DFlipFlop, SRFlipFlop, Clock, Macro };
+
+/// How the optimized schedule of a netlist treats a gate
+enum class GateRole
+{
+    /// Calculated as usual
+    Evaluated,
+    /// Outputs reach no sink, never calculated
+    Dead,
+    /// Inputs cannot change, calculated once when scheduled
+    Constant,
+    /// Same function and inputs as another gate, outputs copied from it
+    Merged,
+    /// Part of a cluster evaluated from a truth table
+    Clustered
+};
+
 
 class Game;
+class Netlist;
 
 /**
  * This class represents the gate used in the game
@@ -30,18 +51,47 @@ private:
     /// The Game that these gates are contained in
     Game* mGame;
 
+    /// Logic level of the gate, the length of the longest
+    /// chain of gates driving its inputs
+    int mLevel = 0;
+
+    /// The netlist this gate is wired into, if any
+    Netlist* mNetlist = nullptr;
+
+    /// True if an input changed since the gate was last calculated
+    bool mDirty = false;
+
+    /// Index of the feedback loop this gate is in, -1 if none
+    int mLoop = -1;
+
+    /// How the netlist schedules this gate
+    GateRole mRole = GateRole::Evaluated;
+
+    /// Index of the truth table this gate is in, -1 if none
+    int mCluster = -1;
+
 protected:
     /// Vector of the Pins of a gate
     std::vector<std::shared_ptr<Pin>> mPins;
 
+    /// The input pins, in the order they were added
+    std::vector<std::shared_ptr<Pin>> mInputPins;
+
+    /// The output pins, in the order they were added
+    std::vector<std::shared_ptr<Pin>> mOutputPins;
+
+    void AddPin(std::shared_ptr<Pin> pin);
+
 public:
     /**
     * Constructor
     * @param game the game object
     */
-    Gate(Game* game) : Item(game)
-    {
-    };
+    Gate(Game* game);
+
+    ~Gate() override;
+
+    static size_t GetLiveCount();
 
 
     bool HitTest(int x, int y) override;
@@ -53,17 +103,25 @@ public:
     virtual const wxSize GetSize() = 0;
 
 
-    std::vector<std::shared_ptr<Pin>> GetInputPins();
+    /**
+     * Getter for input pins only
+     * @return View of the input pins of the gate
+     */
+    PinSpan GetInputPins() const { return mInputPins; }
 
-    std::vector<std::shared_ptr<Pin>> GetOutputPins();
+    /**
+     * Getter for output pins only
+     * @return View of the output pins of the gate
+     */
+    PinSpan GetOutputPins() const { return mOutputPins; }
 
-    virtual void SetOutput(std::shared_ptr<Pin>& pin, PinState state);
+    virtual void SetOutput(const std::shared_ptr<Pin>& pin, PinState state);
 
     /**
      * Getter for the pins of the gate
      * @return Vector of Pins
      */
-    std::vector<std::shared_ptr<Pin>> GetPins() { return mPins; }
+    const std::vector<std::shared_ptr<Pin>>& GetPins() const { return mPins; }
 
     /**
      * Getter for gate pointer
@@ -71,13 +129,152 @@ public:
      */
     Gate* AsGate() override { return this; }
 
+    /**
+     * Getter for the logic level of the gate
+     * @return Logic level, 0 if no gate drives this gate
+     */
+    int GetLevel() const { return mLevel; }
+
+    /**
+     * Setter for the logic level of the gate
+     * @param level Logic level assigned by the netlist
+     */
+    void SetLevel(int level) { mLevel = level; }
+
+    /**
+     * Getter for the netlist this gate is wired into
+     * @return Pointer to the netlist, nullptr if not in one
+     */
+    Netlist* GetNetlist() const { return mNetlist; }
+
+    /**
+     * Setter for the netlist this gate is wired into
+     * @param netlist Netlist the gate was added to, nullptr when removed
+     */
+    void SetNetlist(Netlist* netlist) { mNetlist = netlist; }
+
+    /**
+     * Is this gate waiting to be calculated
+     * @return True if an input changed since the last calculation
+     */
+    bool IsDirty() const { return mDirty; }
+
+    /**
+     * Setter for the dirty flag, only changed by the netlist
+     * @param dirty True if the gate needs to be calculated
+     */
+    void SetDirty(bool dirty) { mDirty = dirty; }
+
+    /**
+     * Getter for the feedback loop this gate is in
+     * @return Index of the loop in the netlist, -1 if not in a loop
+     */
+    int GetLoop() const { return mLoop; }
+
+    /**
+     * Setter for the feedback loop this gate is in
+     * @param loop Index of the loop assigned by the netlist, -1 for none
+     */
+    void SetLoop(int loop) { mLoop = loop; }
+
+    /**
+     * Getter for how the netlist schedules this gate
+     * @return The role of the gate in the optimized schedule
+     */
+    GateRole GetRole() const { return mRole; }
+
+    /**
+     * Setter for how the netlist schedules this gate
+     * @param role Role assigned by the netlist
+     */
+    void SetRole(GateRole role) { mRole = role; }
+
+    /**
+     * Getter for the truth table cluster this gate is in
+     * @return Index of the table in the netlist, -1 if not in a cluster
+     */
+    int GetCluster() const { return mCluster; }
+
+    /**
+     * Setter for the truth table cluster this gate is in
+     * @param cluster Index of the table assigned by the netlist, -1 for none
+     */
+    void SetCluster(int cluster) { mCluster = cluster; }
+
+    void OnInputChanged();
+
     /**
      * Calculates the output of a gate
      */
     virtual void calculate() = 0;
 
+    /**
+     * Get the logic function of this gate
+     * @return The operation the circuit compiler emits for this gate
+     */
+    virtual GateOp GetOp() const = 0;
+
+    /**
+     * Get how many states the gate remembers between calculations
+     * @return Number of states read by GetMemory and written by SetMemory
+     */
+    virtual int GetMemorySize() const { return 0; }
+
+    /**
+     * Copy the remembered states of the gate out
+     * @param memory Array of GetMemorySize() states to fill
+     */
+    virtual void GetMemory(PinState* memory) const {}
+
+    /**
+     * Replace the remembered states of the gate
+     * @param memory Array of GetMemorySize() states
+     */
+    virtual void SetMemory(const PinState* memory) {}
+
+    /**
+     * Is this a clocked gate that latches its inputs once per tick.
+     *
+     * The outputs of a sequential gate only change in the commit
+     * phase of a tick, so the netlist does not order the gates it
+     * drives after it.
+     * @return True for flip flops and clocks
+     */
+    virtual bool IsSequential() const { return false; }
+
+    /**
+     * Read the inputs of a sequential gate and work out its next
+     * state, without changing any outputs
+     */
+    virtual void Sample() {}
+
+    /**
+     * Drive the outputs of a sequential gate from the state
+     * worked out by the last Sample
+     */
+    virtual void Commit() {}
+
+    /**
+     * Get the propagation delay of the gate, used in timed mode
+     * @return Time units from an input changing to the output changing
+     */
+    virtual int GetDelay() const { return 1; }
+
+    /**
+     * Accept a visitor for the gate
+     * @param visitor The visitor to accept
+     */
+    void Accept(ItemVisitor* visitor) override { visitor->VisitGates(this); }
+
+    /**
+     * Gates are drawn above the machines
+     * @return The gates layer
+     */
+    Layer GetLayer() const override { return Layer::Gates; }
+
     std::shared_ptr<Pin> PinHitTest(int x, int y) override;
     void Update(double elapsed) override;
+    void DrawWires(std::shared_ptr<wxGraphicsContext> graphics) override;
 };
 
 
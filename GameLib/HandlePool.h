@@ -0,0 +1,177 @@
+/**
+ * @file HandlePool.h
+ * @author Ethan Springer, Daksh Mehta, Sehaj Gupta, Lukas Schaefer, Jack McNamara
+ *
+ * Dense integer handles to objects that can tell when the object is gone
+ */
+
+#ifndef HANDLEPOOL_H
+#define HANDLEPOOL_H
+
+#include <cstdint>
+#include <vector>
+
+/**
+ * A reference to an object in a HandlePool.
+ *
+ * The index is a small dense integer, so tables about the objects
+ * can be plain vectors. The generation changes each time the slot
+ * is reused, so a handle kept after its object is gone does not
+ * find the object that took its place.
+ */
+class Handle
+{
+private:
+    /// Slot of the object in the pool
+    uint32_t mIndex = 0;
+
+    /// Generation of the slot when the handle was made, 0 for no object
+    uint32_t mGeneration = 0;
+
+public:
+    /// Constructor for a handle to no object
+    Handle() = default;
+
+    /**
+     * Constructor
+     * @param index Slot of the object in the pool
+     * @param generation Generation of the slot
+     */
+    Handle(uint32_t index, uint32_t generation) : mIndex(index), mGeneration(generation) {}
+
+    /**
+     * Get the slot of the object
+     * @return Dense index, less than the capacity of the pool
+     */
+    uint32_t GetIndex() const { return mIndex; }
+
+    /**
+     * Get the generation of the slot when the handle was made
+     * @return Generation, 0 for a handle to no object
+     */
+    uint32_t GetGeneration() const { return mGeneration; }
+
+    /**
+     * Is this a handle to no object
+     * @return True if the handle was default constructed
+     */
+    bool IsNull() const { return mGeneration == 0; }
+
+    /**
+     * Do two handles refer to the same object
+     * @param other Handle to compare to
+     * @return True if the index and generation match
+     */
+    bool operator==(const Handle& other) const
+    {
+        return mIndex == other.mIndex && mGeneration == other.mGeneration;
+    }
+
+    /**
+     * Do two handles refer to different objects
+     * @param other Handle to compare to
+     * @return True if the index or generation differ
+     */
+    bool operator!=(const Handle& other) const { return !(*this == other); }
+};
+
+/**
+ * Hands out handles to objects it does not own.
+ *
+ * Freed slots are reused, the last freed first, so the indices
+ * stay dense. Looking up a handle is an array index and a
+ * generation compare.
+ * @tparam T Type of the objects
+ */
+template <class T>
+class HandlePool
+{
+private:
+    /// One slot of the pool
+    struct Slot
+    {
+        /// The object, nullptr while the slot is free
+        T* object = nullptr;
+        /// Changed every time the slot is freed
+        uint32_t generation = 1;
+    };
+
+    /// The slots, indexed by Handle::GetIndex
+    std::vector<Slot> mSlots;
+
+    /// Indices of the free slots
+    std::vector<uint32_t> mFree;
+
+public:
+    /**
+     * Add an object to the pool
+     * @param object The object, which must be removed before it is destroyed
+     * @return Handle to the object
+     */
+    Handle Add(T* object)
+    {
+        uint32_t index;
+        if (!mFree.empty())
+        {
+            index = mFree.back();
+            mFree.pop_back();
+        }
+        else
+        {
+            index = uint32_t(mSlots.size());
+            mSlots.emplace_back();
+        }
+        mSlots[index].object = object;
+        return Handle(index, mSlots[index].generation);
+    }
+
+    /**
+     * Remove an object from the pool, making its handles stale
+     * @param handle Handle returned by Add, ignored if already stale
+     */
+    void Remove(Handle handle)
+    {
+        if (Get(handle) == nullptr)
+        {
+            return;
+        }
+        Slot& slot = mSlots[handle.GetIndex()];
+        slot.object = nullptr;
+        // Generation 0 is kept for null handles
+        if (++slot.generation == 0)
+        {
+            slot.generation = 1;
+        }
+        mFree.push_back(handle.GetIndex());
+    }
+
+    /**
+     * Find the object of a handle
+     * @param handle Handle returned by Add
+     * @return The object, nullptr if the handle is null or stale
+     */
+    T* Get(Handle handle) const
+    {
+        if (handle.GetIndex() >= mSlots.size())
+        {
+            return nullptr;
+        }
+        const Slot& slot = mSlots[handle.GetIndex()];
+        return slot.generation == handle.GetGeneration() ? slot.object : nullptr;
+    }
+
+    /**
+     * Get the number of slots, one more than the highest index handed out
+     * @return Size for a vector indexed by Handle::GetIndex
+     */
+    size_t GetCapacity() const { return mSlots.size(); }
+
+    /**
+     * Get the number of objects in the pool
+     * @return Slots in use
+     */
+    size_t GetCount() const { return mSlots.size() - mFree.size(); }
+};
+
+
+#endif //HANDLEPOOL_H
@@ -12,11 +12,27 @@
 
 using namespace std;
 
+/**
+ * Constructor
+ * @param game The game this item is a member of
+ */
+Item::Item(Game* game) : mGame(game)
+{
+    if (mGame)
+    {
+        mHandle = mGame->GetHandles().Add(this);
+    }
+}
+
 /**
  * Destructor
  */
 Item::~Item()
 {
+    if (mGame)
+    {
+        mGame->GetHandles().Remove(mHandle);
+    }
 }
 
 /**
@@ -65,5 +81,9 @@ void Item::SetLocation(double x, double y)
  {
   mX = x;
   mY = y;
+  if (mGame)
+  {
+   mGame->OnItemMoved(this);
+  }
  }
 }
\ No newline at end of file
@@ -8,6 +8,7 @@
 #ifndef ITEM_H
 #define ITEM_H
 
+#include "HandlePool.h"
 #include "Score.h"
 
 
@@ -15,6 +16,26 @@ class ItemVisitor;
 class Game;
 class Gate;
 class Pin;
+class RenderLayers;
+
+/// The layers items are drawn in, bottom first. The background
+/// is filled by the game before the first layer, and the wires
+/// are drawn by DrawWires of the machines and gates after the
+/// Gates layer and before the Overlay layer.
+enum class Layer
+{
+    /// The conveyor and the products on it
+    Conveyor,
+    /// Beams, sensors, property boxes and Sparty
+    Machines,
+    /// The gates
+    Gates,
+    /// The scoreboard
+    Overlay
+};
+
+/// Number of values of Layer
+const int LayerCount = int(Layer::Overlay) + 1;
 
 /// Base class for all the items
 class Item
@@ -24,10 +45,7 @@ protected:
      * Constructor
      * @param game The game this item is a member of
      */
-    Item(Game* game)
-    {
-        mGame = game;
-    };
+    Item(Game* game);
 
 private:
     /// Game we are using
@@ -36,6 +54,20 @@ private:
     double mX = 500; ///< X location for the center of the item
     double mY = 500; ///< Y location for the center of the item
 
+    /// Handle of the item in the game
+    Handle mHandle;
+
+    /// Item drawn just below this one in its layer
+    Item* mLayerBelow = nullptr;
+
+    /// Item drawn just above this one in its layer
+    Item* mLayerAbove = nullptr;
+
+    /// True while the item is in the render layers of the game
+    bool mLayered = false;
+
+    friend class RenderLayers;
+
 
 public:
     virtual ~Item();
@@ -46,6 +78,12 @@ public:
      */
     Game* GetGame() { return mGame; }
 
+    /**
+     * Get the handle of the item, which the game can look it up by
+     * @return Handle that goes stale when the item is destroyed
+     */
+    Handle GetHandle() const { return mHandle; }
+
 
     /**
     * The X location of the item
@@ -93,10 +131,31 @@ public:
 
     virtual void Draw(std::shared_ptr<wxGraphicsContext> gc);
 
+    /**
+     * Draw the wires from the output pins of the item. Called
+     * after the Gates layer is drawn and before the Overlay layer
+     * @param gc Device context to draw on
+     */
+    virtual void DrawWires(std::shared_ptr<wxGraphicsContext> gc)
+    {
+    }
+
+    /**
+     * Get the layer the item is drawn in
+     * @return Layer, Machines unless the item overrides it
+     */
+    virtual Layer GetLayer() const { return Layer::Machines; }
+
     virtual void XmlLoad(wxXmlNode* node);
 
     virtual bool HitTest(int x, int y);
 
+    /**
+     * Can a click hit this item or one of its pins
+     * @return True unless the item overrides it, so the item is hit tested
+     */
+    virtual bool IsClickable() const { return true; }
+
 
     /**
      * Function to update items based on timer
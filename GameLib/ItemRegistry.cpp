@@ -0,0 +1,84 @@
+/**
+ * @file ItemRegistry.cpp
+ * @author Ethan Springer, Daksh Mehta, Sehaj Gupta, Lukas Schaefer, Jack McNamara
+ */
+
+#include "pch.h"
+#include "ItemRegistry.h"
+
+/**
+ * Record a gate
+ * @param gate Gate added to the game
+ */
+void ItemRegistry::VisitGates(Gate* gate)
+{
+    mGates.push_back(gate);
+}
+
+/**
+ * Record the conveyor
+ * @param conveyor Conveyor added to the game
+ */
+void ItemRegistry::VisitConveyors(Conveyor* conveyor)
+{
+    mConveyor = conveyor;
+}
+
+/**
+ * Record a product
+ * @param product Product added to the game
+ */
+void ItemRegistry::VisitProduct(Product* product)
+{
+    mProducts.push_back(product);
+}
+
+/**
+ * Record Sparty
+ * @param sparty Sparty added to the game
+ */
+void ItemRegistry::VisitSparty(Sparty* sparty)
+{
+    mSparty = sparty;
+}
+
+/**
+ * Record a sensor
+ * @param sensor Sensor added to the game
+ */
+void ItemRegistry::VisitSensor(Sensor* sensor)
+{
+    mSensors.push_back(sensor);
+}
+
+/**
+ * Record a beam
+ * @param beam Beam added to the game
+ */
+void ItemRegistry::VisitBeam(Beam* beam)
+{
+    mBeams.push_back(beam);
+}
+
+/**
+ * Record a property box
+ * @param box Property box added to the game
+ */
+void ItemRegistry::VisitPropertyBox(PropertyBox* box)
+{
+    mPropertyBoxes.push_back(box);
+}
+
+/**
+ * Forget every item, when the game is cleared
+ */
+void ItemRegistry::Clear()
+{
+    mConveyor = nullptr;
+    mSparty = nullptr;
+    mSensors.clear();
+    mBeams.clear();
+    mProducts.clear();
+    mGates.clear();
+    mPropertyBoxes.clear();
+}
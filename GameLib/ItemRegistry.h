@@ -0,0 +1,99 @@
+/**
+ * @file ItemRegistry.h
+ * @author Ethan Springer, Daksh Mehta, Sehaj Gupta, Lukas Schaefer, Jack McNamara
+ *
+ * The items of a game sorted by type as they are added
+ */
+
+#ifndef ITEMREGISTRY_H
+#define ITEMREGISTRY_H
+
+#include <vector>
+#include "ItemVisitor.h"
+
+/**
+ * The items of a game sorted by type as they are added.
+ *
+ * The game passes every item it adds to the registry as a
+ * visitor, so finding the conveyor or Sparty, or going through
+ * the products, does not walk every item in the game.
+ */
+class ItemRegistry : public ItemVisitor
+{
+private:
+    /// The conveyor, nullptr if none
+    Conveyor* mConveyor = nullptr;
+
+    /// Sparty, nullptr if none
+    Sparty* mSparty = nullptr;
+
+    /// The sensors, in the order they were added
+    std::vector<Sensor*> mSensors;
+
+    /// The beams, in the order they were added
+    std::vector<Beam*> mBeams;
+
+    /// The products, in the order they were added
+    std::vector<Product*> mProducts;
+
+    /// The gates, in the order they were added
+    std::vector<Gate*> mGates;
+
+    /// The property boxes, in the order they were added
+    std::vector<PropertyBox*> mPropertyBoxes;
+
+public:
+    void VisitGates(Gate* gate) override;
+    void VisitConveyors(Conveyor* conveyor) override;
+    void VisitProduct(Product* product) override;
+    void VisitSparty(Sparty* sparty) override;
+    void VisitSensor(Sensor* sensor) override;
+    void VisitBeam(Beam* beam) override;
+    void VisitPropertyBox(PropertyBox* box) override;
+    void Clear();
+
+    /**
+     * Get the conveyor
+     * @return Pointer to the conveyor, nullptr if there is none
+     */
+    Conveyor* GetConveyor() const { return mConveyor; }
+
+    /**
+     * Get Sparty
+     * @return Pointer to Sparty, nullptr if there is none
+     */
+    Sparty* GetSparty() const { return mSparty; }
+
+    /**
+     * Get the sensors
+     * @return Sensors in the order they were added
+     */
+    const std::vector<Sensor*>& GetSensors() const { return mSensors; }
+
+    /**
+     * Get the beams
+     * @return Beams in the order they were added
+     */
+    const std::vector<Beam*>& GetBeams() const { return mBeams; }
+
+    /**
+     * Get the products
+     * @return Products in the order they were added
+     */
+    const std::vector<Product*>& GetProducts() const { return mProducts; }
+
+    /**
+     * Get the gates
+     * @return Gates in the order they were added
+     */
+    const std::vector<Gate*>& GetGates() const { return mGates; }
+
+    /**
+     * Get the property boxes
+     * @return Property boxes in the order they were added
+     */
+    const std::vector<PropertyBox*>& GetPropertyBoxes() const { return mPropertyBoxes; }
+};
+
+
+#endif //ITEMREGISTRY_H
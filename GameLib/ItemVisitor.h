@@ -75,6 +75,12 @@ public:
   */
  virtual void VisitSensor(Sensor* sensor) {};
 
+ /**
+  * Virtual function to visit beams
+  * @param beam the beam being visited
+  */
+ virtual void VisitBeam(Beam* beam) {};
+
 };
 
 
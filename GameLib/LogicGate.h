@@ -0,0 +1,121 @@
+/**
+ * @file LogicGate.h
+ * @author Ethan Springer, Daksh Mehta, Sehaj Gupta, Lukas Schaefer, Jack McNamara
+ *
+ * A combinational gate with N inputs and one output
+ */
+
+#ifndef LOGICGATE_H
+#define LOGICGATE_H
+
+#include <array>
+#include "Game.h"
+#include "Gate.h"
+#include "Pin.h"
+
+/**
+ * A combinational gate with N inputs and one output.
+ *
+ * The Op class supplies the truth function and the shape:
+ *  - Op::Op, the GateOp for the circuit compiler
+ *  - Op::Width and Op::Height, the size of the two input gate
+ *  - Op::Delay, the propagation delay in timed mode
+ *  - Op::InputInset and Op::OutputInset, how far the pins sit
+ *    inside the left edge and left of the gate width
+ *  - Op::Evaluate(inputs), a constexpr truth function over an
+ *    std::array of N input states
+ *  - Op::Draw(graphics, x, y, w, h), which draws the body
+ *
+ * The number of inputs is fixed at compile time, so calculate
+ * reads the pins into a fixed size array and the truth function
+ * is inlined and unrolled for each variant. Gates with more than
+ * two inputs are scaled up so the pins keep the same spacing.
+ * @tparam Op Truth function and shape of the gate
+ * @tparam N Number of inputs, at least 2
+ */
+template <class Op, int N>
+class LogicGate : public Gate
+{
+    static_assert(N >= 2, "A logic gate needs at least two inputs");
+
+public:
+    /// Number of inputs
+    static constexpr int Inputs = N;
+
+    /// How much larger than the two input gate this gate is drawn
+    static constexpr double Scale = N / 2.0;
+
+private:
+    /// Size of the gate in pixels
+    const wxSize mSize = wxSize(int(Op::Width * Scale), int(Op::Height * Scale));
+
+public:
+    // deleting default constructors
+    LogicGate() = delete;
+    LogicGate(const LogicGate&) = delete;
+    void operator=(const LogicGate&) = delete;
+
+    /**
+     * Constructor
+     * @param game The game this gate belongs to
+     */
+    LogicGate(Game* game) : Gate(game)
+    {
+        double w = mSize.GetWidth();
+        double h = mSize.GetHeight();
+        for (int i = 0; i < N; i++)
+        {
+            // Inputs are evenly spaced down the left edge
+            double y = -h / 2 + (i + 0.5) * h / N;
+            AddPin(game->MakePin(PinType::INPUT, -w / 2 + Op::InputInset * Scale, y));
+        }
+        AddPin(game->MakePin(PinType::OUTPUT, w - Op::OutputInset * Scale, 0));
+    }
+
+    /**
+     * Draw the gate and its pins
+     * @param graphics Graphics context to draw on
+     */
+    void Draw(std::shared_ptr<wxGraphicsContext> graphics) override
+    {
+        Op::Draw(graphics, GetX(), GetY(), mSize.GetWidth(), mSize.GetHeight());
+        for (const auto& pin : mPins)
+        {
+            pin->Draw(graphics);
+        }
+    }
+
+    /**
+     * Get the size of the gate
+     * @return Size of the gate in pixels
+     */
+    const wxSize GetSize() override { return mSize; }
+
+    /**
+     * Decides the output state of the gate
+     */
+    void calculate() override
+    {
+        std::array<PinState, N> states;
+        for (int i = 0; i < N; i++)
+        {
+            states[i] = mInputPins[i]->GetState();
+        }
+        SetOutput(mOutputPins[0], Op::Evaluate(states));
+    }
+
+    /**
+     * Get the logic function of this gate
+     * @return The operation of Op
+     */
+    GateOp GetOp() const override { return Op::Op; }
+
+    /**
+     * Get the propagation delay of this gate
+     * @return Op::Delay
+     */
+    int GetDelay() const override { return Op::Delay; }
+};
+
+
+#endif //LOGICGATE_H
@@ -0,0 +1,157 @@
+/**
+ * @file MacroDefinition.cpp
+ * @author Ethan Springer, Daksh Mehta, Sehaj Gupta, Lukas Schaefer, Jack McNamara
+ */
+
+#include "pch.h"
+#include "MacroDefinition.h"
+#include "DependencyGraph.h"
+#include "Net.h"
+#include <algorithm>
+#include <map>
+#include <unordered_set>
+
+using namespace std;
+
+/**
+ * Package a group of gates.
+ *
+ * The combinational gates are compiled in level order and the
+ * flip flops after them, so a flip flop changes what the group
+ * outputs the next time it is run.
+ * @param gates Gates of the group, wired to each other
+ * @return The definition, nullptr if the group is empty or has
+ * a feedback loop, a clock or a macro. The program of a macro
+ * only points at the definitions it runs, so it cannot hold
+ * another macro that may outlive its last instance.
+ */
+shared_ptr<MacroDefinition> MacroDefinition::Package(const vector<Gate*>& gates)
+{
+    if (gates.empty())
+    {
+        return nullptr;
+    }
+
+    unordered_set<Gate*> group(gates.begin(), gates.end());
+    DependencyGraph graph;
+    vector<Gate*> combinational;
+    vector<Gate*> sequential;
+    for (Gate* gate : gates)
+    {
+        if (gate->GetOp() == GateOp::Clock || gate->GetOp() == GateOp::Macro)
+        {
+            return nullptr;
+        }
+
+        for (const auto& pin : gate->GetInputPins())
+        {
+            Net* net = pin->GetNet();
+            Pin* driver = net ? net->GetDriver() : nullptr;
+            Gate* source = driver ? driver->getSourceGate() : nullptr;
+            if (source && group.count(source) && !source->IsSequential())
+            {
+                graph.AddDependency(source, gate);
+            }
+        }
+
+        if (gate->IsSequential())
+        {
+            sequential.push_back(gate);
+        }
+        else
+        {
+            combinational.push_back(gate);
+        }
+    }
+
+    // The program runs each gate once, so it cannot settle a loop
+    if (!graph.FindLoops(combinational).empty())
+    {
+        return nullptr;
+    }
+
+    auto levels = graph.Levelize(combinational);
+    vector<Gate*> order;
+    for (auto& level : levels)
+    {
+        order.insert(order.end(), level.begin(), level.end());
+    }
+    order.insert(order.end(), sequential.begin(), sequential.end());
+
+    shared_ptr<MacroDefinition> macro(new MacroDefinition());
+    macro->mGateCount = gates.size();
+    macro->mDepth = max<int>(levels.size(), 1);
+    macro->mSequential = !sequential.empty();
+
+    CompiledCircuit& circuit = macro->mCircuit;
+    circuit.Compile(order);
+    size_t outputCount = circuit.GetOutputCount();
+    macro->mSlotCount = circuit.GetSlotCount();
+
+    // External slots reading the same net share one input
+    map<const void*, vector<uint32_t>> inputs;
+    vector<const void*> inputOrder;
+    auto& external = circuit.GetExternalPins();
+    for (size_t i = 0; i < external.size(); i++)
+    {
+        Net* net = external[i]->GetNet();
+        const void* key = net ? static_cast<const void*>(net) : external[i];
+        auto& slots = inputs[key];
+        if (slots.empty())
+        {
+            inputOrder.push_back(key);
+        }
+        slots.push_back(uint32_t(outputCount + i));
+    }
+    for (const void* key : inputOrder)
+    {
+        macro->mInputFirst.push_back(macro->mInputTargets.size());
+        auto& slots = inputs[key];
+        macro->mInputTargets.insert(macro->mInputTargets.end(), slots.begin(), slots.end());
+    }
+    macro->mInputFirst.push_back(macro->mInputTargets.size());
+
+    auto& outputs = circuit.GetOutputPins();
+    for (size_t slot = 0; slot < outputs.size(); slot++)
+    {
+        for (Pin* sink : outputs[slot]->GetNet()->GetSinks())
+        {
+            if (group.count(sink->getSourceGate()) == 0)
+            {
+                macro->mOutputSlots.push_back(slot);
+                break;
+            }
+        }
+    }
+    if (macro->mOutputSlots.empty())
+    {
+        for (size_t slot = 0; slot < outputs.size(); slot++)
+        {
+            if (outputs[slot]->GetNet()->GetSinks().empty())
+            {
+                macro->mOutputSlots.push_back(slot);
+            }
+        }
+    }
+
+    // Outputs start as the gates were, inputs as UNKNOWN
+    macro->mInitial = circuit.GetState();
+    macro->mInitial.insert(macro->mInitial.end(), circuit.GetMemory().begin(), circuit.GetMemory().end());
+
+    circuit.Detach();
+    return macro;
+}
+
+/**
+ * Load an input of an instance
+ * @param instance State vector of the instance
+ * @param input Index of the input
+ * @param state State of the input
+ */
+void MacroDefinition::SetInput(PinState* instance, size_t input, PinState state) const
+{
+    for (uint32_t i = mInputFirst[input]; i < mInputFirst[input + 1]; i++)
+    {
+        instance[mInputTargets[i]] = state;
+    }
+}
@@ -0,0 +1,124 @@
+/**
+ * @file MacroDefinition.h
+ * @author Ethan Springer, Daksh Mehta, Sehaj Gupta, Lukas Schaefer, Jack McNamara
+ *
+ * A group of gates compiled once and shared by every MacroGate made from it
+ */
+
+#ifndef MACRODEFINITION_H
+#define MACRODEFINITION_H
+
+#include <cstdint>
+#include <memory>
+#include <vector>
+#include "CompiledCircuit.h"
+
+/**
+ * A group of gates compiled once and shared by every MacroGate made from it.
+ *
+ * The gates are compiled into a CompiledCircuit and can then be
+ * destroyed. Each instance keeps only a state vector: the slots
+ * of the circuit followed by the remembered states of its flip
+ * flops. Inputs of the group not driven from inside it become
+ * the inputs of the macro, one for each net they read, and
+ * outputs wired outside the group become its outputs. If no
+ * output is wired outside, the outputs wired to nothing are used.
+ *
+ * A group with a feedback loop or a clock cannot be packaged.
+ */
+class MacroDefinition
+{
+private:
+    /// The program of the group, detached from its gates
+    CompiledCircuit mCircuit;
+
+    /// Index into mInputTargets of the first slot of each input, and the end
+    std::vector<uint32_t> mInputFirst;
+
+    /// Slots each input is loaded into, grouped by input
+    std::vector<uint32_t> mInputTargets;
+
+    /// Slot of each output
+    std::vector<uint32_t> mOutputSlots;
+
+    /// State vector of a new instance
+    std::vector<PinState> mInitial;
+
+    /// Number of slots, the memory follows them in the state vector
+    size_t mSlotCount = 0;
+
+    /// Number of gates in the group
+    size_t mGateCount = 0;
+
+    /// Logic levels of the group
+    int mDepth = 0;
+
+    /// True if the group has a flip flop
+    bool mSequential = false;
+
+    MacroDefinition() = default;
+
+public:
+    /// Copy constructor (disabled)
+    MacroDefinition(const MacroDefinition&) = delete;
+
+    /// Assignment operator (disabled)
+    void operator=(const MacroDefinition&) = delete;
+
+    static std::shared_ptr<MacroDefinition> Package(const std::vector<Gate*>& gates);
+
+    void SetInput(PinState* instance, size_t input, PinState state) const;
+
+    /**
+     * Run the group over the state vector of an instance
+     * @param instance State vector of the instance
+     */
+    void Run(PinState* instance) const { mCircuit.Execute(instance, instance + mSlotCount); }
+
+    /**
+     * Get the state of an output of an instance
+     * @param instance State vector of the instance
+     * @param output Index of the output
+     * @return State of the output as of the last Run
+     */
+    PinState GetOutput(const PinState* instance, size_t output) const { return instance[mOutputSlots[output]]; }
+
+    /**
+     * Get the number of inputs of the macro
+     * @return Number of inputs
+     */
+    size_t GetInputCount() const { return mInputFirst.size() - 1; }
+
+    /**
+     * Get the number of outputs of the macro
+     * @return Number of outputs
+     */
+    size_t GetOutputCount() const { return mOutputSlots.size(); }
+
+    /**
+     * Get the state vector of a new instance
+     * @return Slot states followed by remembered states
+     */
+    const std::vector<PinState>& GetInitialState() const { return mInitial; }
+
+    /**
+     * Get the number of gates packaged
+     * @return Gates in the group
+     */
+    size_t GetGateCount() const { return mGateCount; }
+
+    /**
+     * Get the length of the longest chain of gates in the group
+     * @return Number of logic levels
+     */
+    int GetDepth() const { return mDepth; }
+
+    /**
+     * Does the group have a flip flop
+     * @return True if instances must be latched once per tick
+     */
+    bool IsSequential() const { return mSequential; }
+};
+
+
+#endif //MACRODEFINITION_H
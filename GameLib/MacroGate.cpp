@@ -0,0 +1,125 @@
+/**
+ * @file MacroGate.cpp
+ * @author Ethan Springer, Daksh Mehta, Sehaj Gupta, Lukas Schaefer, Jack McNamara
+ */
+
+#include "pch.h"
+#include "MacroGate.h"
+#include "Game.h"
+#include <algorithm>
+
+using namespace std;
+
+/// Width of a macro in pixels
+const int MacroWidth = 60;
+
+/// Vertical distance between the pins of a macro
+const int MacroPinSpacing = 25;
+
+/// Gap between the edge of the macro and its label
+const int MacroLabelMargin = 5;
+
+/**
+ * Constructor
+ * @param game The game this gate belongs to
+ * @param definition The packaged group to make an instance of
+ */
+MacroGate::MacroGate(Game* game, shared_ptr<const MacroDefinition> definition) :
+	Gate(game), mDefinition(std::move(definition)), mInstance(mDefinition->GetInitialState())
+{
+	size_t inputs = mDefinition->GetInputCount();
+	size_t outputs = mDefinition->GetOutputCount();
+	size_t rows = max<size_t>(max(inputs, outputs), 2);
+	mSize = wxSize(MacroWidth, int(rows * MacroPinSpacing));
+
+	double w = mSize.GetWidth();
+	double h = mSize.GetHeight();
+	for (size_t i = 0; i < inputs; i++)
+	{
+		double y = -h / 2 + (i + 0.5) * h / inputs;
+		AddPin(game->MakePin(PinType::INPUT, -w / 2, y));
+	}
+	for (size_t i = 0; i < outputs; i++)
+	{
+		double y = -h / 2 + (i + 0.5) * h / outputs;
+		AddPin(game->MakePin(PinType::OUTPUT, w / 2, y, mDefinition->GetOutput(mInstance.data(), i)));
+	}
+}
+
+/**
+ * Draw the macro as a box with its pins
+ * @param gc the graphics context to draw on
+ */
+void MacroGate::Draw(std::shared_ptr<wxGraphicsContext> gc)
+{
+	gc->SetPen(*wxBLACK_PEN);
+	gc->SetBrush(*wxWHITE_BRUSH);
+
+	auto w = GetSize().GetWidth();
+	auto h = GetSize().GetHeight();
+	auto x = GetX() - w / 2;
+	auto y = GetY() - h / 2;
+	gc->DrawRectangle(x, y, w, h);
+
+	auto font = gc->CreateFont(12, L"Arial", wxFONTFLAG_BOLD, *wxBLACK);
+	gc->SetFont(font);
+	gc->DrawText(L"PKG", x + MacroLabelMargin, y + MacroLabelMargin);
+
+	for (auto pin : mPins)
+	{
+		pin->Draw(gc);
+	}
+}
+
+/**
+ * Decides the output states of the gate
+ *
+ * Runs the packaged group and drives the outputs in one step
+ */
+void MacroGate::calculate()
+{
+	Sample();
+	Commit();
+}
+
+/**
+ * Load the inputs into the state vector and run the group
+ */
+void MacroGate::Sample()
+{
+	PinState* instance = mInstance.data();
+	for (size_t i = 0; i < mInputPins.size(); i++)
+	{
+		mDefinition->SetInput(instance, i, mInputPins[i]->GetState());
+	}
+	mDefinition->Run(instance);
+}
+
+/**
+ * Drive the outputs from the state vector
+ */
+void MacroGate::Commit()
+{
+	for (size_t i = 0; i < mOutputPins.size(); i++)
+	{
+		SetOutput(mOutputPins[i], mDefinition->GetOutput(mInstance.data(), i));
+	}
+}
+
+/**
+ * Copy the state vector of the instance out
+ * @param memory Array of GetMemorySize() states to fill
+ */
+void MacroGate::GetMemory(PinState* memory) const
+{
+	copy(mInstance.begin(), mInstance.end(), memory);
+}
+
+/**
+ * Replace the state vector of the instance
+ * @param memory Array of GetMemorySize() states
+ */
+void MacroGate::SetMemory(const PinState* memory)
+{
+	copy(memory, memory + mInstance.size(), mInstance.begin());
+}
@@ -0,0 +1,91 @@
+/**
+ * @file MacroGate.h
+ * @author Ethan Springer, Daksh Mehta, Sehaj Gupta, Lukas Schaefer, Jack McNamara
+ *
+ * One instance of a packaged group of gates
+ */
+
+#ifndef MACROGATE_H
+#define MACROGATE_H
+
+#include "Gate.h"
+#include "Pin.h"
+#include "MacroDefinition.h"
+
+/**
+ * One instance of a packaged group of gates.
+ *
+ * The gate has a pin for each input and output of its
+ * MacroDefinition and runs the shared program over its own
+ * state vector, so it costs no Gate or Pin objects inside. An
+ * instance of a group with flip flops is latched once per tick
+ * like a flip flop.
+ */
+class MacroGate : public Gate
+{
+private:
+	/// The packaged group this is an instance of
+	std::shared_ptr<const MacroDefinition> mDefinition;
+
+	/// Slot states and remembered states of this instance
+	std::vector<PinState> mInstance;
+
+	/// size of the gate
+	wxSize mSize;
+
+public:
+	MacroGate() = delete;
+	MacroGate(const MacroGate&) = delete;
+	void operator=(const MacroGate&) = delete;
+
+	MacroGate(Game* game, std::shared_ptr<const MacroDefinition> definition);
+
+	void Draw(std::shared_ptr<wxGraphicsContext> gc) override;
+
+	/**
+	* Getter function for the size of the gate
+	* @return size of the gate
+	*/
+	const wxSize GetSize() override { return mSize; }
+
+	void calculate() override;
+
+	/**
+	 * Get the logic function of this gate
+	 * @return GateOp::Macro
+	 */
+	GateOp GetOp() const override { return GateOp::Macro; }
+
+	/**
+	 * Get the packaged group this is an instance of
+	 * @return The shared definition
+	 */
+	const std::shared_ptr<const MacroDefinition>& GetDefinition() const { return mDefinition; }
+
+	/**
+	 * Get how many states the instance remembers
+	 * @return Size of the state vector
+	 */
+	int GetMemorySize() const override { return int(mInstance.size()); }
+
+	void GetMemory(PinState* memory) const override;
+	void SetMemory(const PinState* memory) override;
+
+	/**
+	 * Is the packaged group latched once per tick
+	 * @return True if the group has a flip flop
+	 */
+	bool IsSequential() const override { return mDefinition->IsSequential(); }
+
+	void Sample() override;
+	void Commit() override;
+
+	/**
+	 * Get the propagation delay of the instance
+	 * @return One time unit per logic level of the group
+	 */
+	int GetDelay() const override { return mDefinition->GetDepth(); }
+};
+
+
+#endif //MACROGATE_H
@@ -75,9 +75,27 @@ void MainFrame::Initialize()
 	gateMenu->Append(IDM_ADDNOTGATE, L"&NOT", L"Add a Not gate");
 	gateMenu->Append(IDM_ADDNANDGATE, L"&NAND", L"Add a Nand gate");
 
+	/// wide gate menu options
+	auto wideMenu = new wxMenu();
+	wideMenu->Append(IDM_ADDANDGATE3, L"AND 3 inputs", L"Add a 3 input AND gate");
+	wideMenu->Append(IDM_ADDANDGATE4, L"AND 4 inputs", L"Add a 4 input AND gate");
+	wideMenu->Append(IDM_ADDANDGATE8, L"AND 8 inputs", L"Add an 8 input AND gate");
+	wideMenu->Append(IDM_ADDORGATE3, L"OR 3 inputs", L"Add a 3 input OR gate");
+	wideMenu->Append(IDM_ADDORGATE4, L"OR 4 inputs", L"Add a 4 input OR gate");
+	wideMenu->Append(IDM_ADDORGATE8, L"OR 8 inputs", L"Add an 8 input OR gate");
+	wideMenu->Append(IDM_ADDNANDGATE3, L"NAND 3 inputs", L"Add a 3 input Nand gate");
+	wideMenu->Append(IDM_ADDNANDGATE4, L"NAND 4 inputs", L"Add a 4 input Nand gate");
+	wideMenu->Append(IDM_ADDNANDGATE8, L"NAND 8 inputs", L"Add an 8 input Nand gate");
+	gateMenu->AppendSubMenu(wideMenu, L"&Wide gates");
+
 	/// flip flop menu options
 	gateMenu->Append(IDM_ADDSRFLIPFLOP, L"&SR Flip flop", L"Add a SR Flip flop");
 	gateMenu->Append(IDM_ADDDFLIPFLOP, L"&D Flip flop", L"Add a D Flip flop");
+	gateMenu->Append(IDM_ADDCLOCK, L"&Clock", L"Add a clock source");
+
+	gateMenu->AppendSeparator();
+	gateMenu->Append(IDM_PACKAGEGATES, L"&Package gates", L"Package the shift-clicked gates for reuse");
+	gateMenu->Append(IDM_ADDPACKAGE, L"Add packa&ge", L"Add an instance of the packaged gates");
 
 	/// Menu bar options
 	menuBar->Append(fileMenu, L"&File");
@@ -16,42 +16,23 @@ const double AndGateControlPointOffset = 0.75;
 /// const 0.5
 const double Half = 0.5;
 
-/// const 0.25
-const double Quarter = 0.25;
-
 /// const 2
 const int Two = 2;
 
 
-NandGate::NandGate(Game* game) : Gate(game)
-{
-	auto inputPin1 = make_shared<Pin>(game, PinType::INPUT, -mSize.GetWidth() * Half,
-									-mSize.GetHeight() * Quarter);
-	auto inputPin2 = make_shared<Pin>(game, PinType::INPUT, -mSize.GetWidth() * Half,
-									mSize.GetHeight() * Quarter);
-	auto outputPin1 = make_shared<Pin>(game, PinType::OUTPUT, mSize.GetWidth(), 0);
-
-	mPins.push_back(inputPin1);
-	mPins.push_back(inputPin2);
-	mPins.push_back(outputPin1);
-}
-
-
 /**
  * Function to draw And gate
  * @param graphics graphics to use
+ * @param x X location of the center of the gate
+ * @param y Y location of the center of the gate
+ * @param w Width of the gate
+ * @param h Height of the gate
  */
-void NandGate::Draw(std::shared_ptr<wxGraphicsContext> graphics)
+void NandOp::Draw(std::shared_ptr<wxGraphicsContext> graphics, double x, double y, double w, double h)
 {
 	// Create a path to draw the gate shape
 	auto path = graphics->CreatePath();
 
-	// The the location and size
-	auto x = GetX();
-	auto y = GetY();
-	auto w = GetSize().GetWidth();
-	auto h = GetSize().GetHeight();
-
 	// Draw the rectangular base first
 	path.MoveToPoint(x - w * Half, y + h * Half); // Start bottom left
 	path.AddLineToPoint(x - w * Half, y - h * Half); // Left vertical line
@@ -83,48 +64,4 @@ void NandGate::Draw(std::shared_ptr<wxGraphicsContext> graphics)
 	double circleRadius = 5; // Adjust the size of the circle
 	graphics->SetBrush(*wxWHITE_BRUSH); // Fill with white
 	graphics->DrawEllipse(x + (w * Half) + (h * Half), y - circleRadius, circleRadius * Two, circleRadius * Two);
-
-	// drawing pins
-	for (auto pin : mPins)
-	{
-		pin->Draw(graphics);
-	}
-}
-
-
-/**
- * Decides the output state of the gate
- */
-void NandGate::calculate()
-{
-	vector<shared_ptr<Pin>> InputPins = GetInputPins();
-	vector<shared_ptr<Pin>> OutputPins = GetOutputPins();
-
-	if (InputPins.size() > 0 && InputPins[0] && InputPins[1])
-	{
-		PinState A = InputPins[0]->GetState();
-		PinState B = InputPins[1]->GetState();
-
-		shared_ptr<Pin> OutputPin = OutputPins[0];
-
-		if (A <= PinState::UNKNOWN || B <= PinState::UNKNOWN || A > PinState::ONE || B > PinState::ONE)
-		{
-			SetOutput(OutputPin,PinState::UNKNOWN);
-		}
-
-		else if (A == PinState::ONE && B == PinState::ONE)
-		{
-			SetOutput(OutputPin,PinState::ZERO);
-		}
-
-		else if (A == PinState::ZERO || B == PinState::ZERO)
-		{
-			SetOutput(OutputPin,PinState::ONE);
-		}
-
-		else
-		{
-			SetOutput(OutputPin,PinState::UNKNOWN);
-		}
-	}
 }
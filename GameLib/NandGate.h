@@ -8,50 +8,67 @@
 #ifndef NandGate_H
 #define NandGate_H
 
-#include "Gate.h"
-#include "Pin.h"
+#include "LogicGate.h"
+#include "AndGate.h"
 
 /**
- * Nand gate class, inherits from gate
+ * The NAND function and shape for LogicGate
  */
-class NandGate : public Gate
+struct NandOp
 {
-private:
-	/// Size of the NAND gate in pixels
-	const wxSize mSize = wxSize(75, 50);
+	/// Operation the circuit compiler emits
+	static constexpr GateOp Op = GateOp::Nand;
 
-	/// The output variable that stores the output value of the gate
-	int mOutput = GateState(UNKNOWN);
+	/// Propagation delay of the NAND gate in time units
+	static constexpr int Delay = 1;
 
-	/// vector to store pins
-	//std::vector<std::shared_ptr<Pin>> mPins;
+	/// Width of the two input NAND gate in pixels
+	static constexpr int Width = 75;
 
-public:
-	// deleting default constructors
-	NandGate() = delete;
-	NandGate(const NandGate&) = delete;
-	void operator=(const NandGate&) = delete;
+	/// Height of the two input NAND gate in pixels
+	static constexpr int Height = 50;
 
-	/**
-	* constructor for nand gate
-	* @param game object of which the gate belongs to
-	*/
-	NandGate(Game* game);
-
-	/// Function to draw the gate
-	void Draw(std::shared_ptr<wxGraphicsContext> graphics) override;
+	/// How far the input pins are inside the left edge
+	static constexpr double InputInset = 0;
 
-	/// Function to calculate the output value of the gate
-	void calculate() override;
+	/// How far the output pin is left of the gate width
+	static constexpr double OutputInset = 0;
 
 	/**
-	* virtual function to get size of gate
-	* @return size of gate
-	*/
-	const wxSize GetSize() override { return mSize; };
+	 * NAND of all the inputs, UNKNOWN if any input is unknown
+	 * @param inputs States of the inputs
+	 * @return The output state
+	 */
+	template <size_t N>
+	static constexpr PinState Evaluate(const std::array<PinState, N>& inputs)
+	{
+		switch (AndOp::Evaluate(inputs))
+		{
+		case PinState::ONE:
+			return PinState::ZERO;
 
+		case PinState::ZERO:
+			return PinState::ONE;
 
+		default:
+			return PinState::UNKNOWN;
+		}
+	}
+
+	static void Draw(std::shared_ptr<wxGraphicsContext> graphics, double x, double y, double w, double h);
 };
 
+/// Two input NAND gate
+using NandGate = LogicGate<NandOp, 2>;
+
+/// Three input NAND gate
+using NandGate3 = LogicGate<NandOp, 3>;
+
+/// Four input NAND gate
+using NandGate4 = LogicGate<NandOp, 4>;
+
+/// Eight input NAND gate
+using NandGate8 = LogicGate<NandOp, 8>;
+
 
 #endif //NNandGate_H
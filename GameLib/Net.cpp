@@ -0,0 +1,61 @@
+/**
+ * @file Net.cpp
+ * @author Ethan Springer, Daksh Mehta, Sehaj Gupta, Lukas Schaefer, Jack McNamara
+ */
+
+#include "pch.h"
+#include "Net.h"
+#include "Gate.h"
+#include <algorithm>
+
+using namespace std;
+
+/**
+ * Constructor
+ * @param driver Output pin that writes the state
+ * @param state Initial state of the signal
+ */
+Net::Net(Pin* driver, PinState state) : mState(state), mDriver(driver)
+{
+}
+
+/**
+ * Write a new state to the net.
+ *
+ * The gates of the input pins are told only if the state changed.
+ * @param state The new state
+ */
+void Net::SetState(PinState state)
+{
+    if (mState == state)
+    {
+        return;
+    }
+
+    mState = state;
+    for (Pin* sink : mSinks)
+    {
+        if (sink->getSourceGate())
+        {
+            sink->getSourceGate()->OnInputChanged();
+        }
+    }
+}
+
+/**
+ * Add an input pin that reads this net
+ * @param pin Input pin wired to the driver
+ */
+void Net::AddSink(Pin* pin)
+{
+    mSinks.push_back(pin);
+}
+
+/**
+ * Remove an input pin that no longer reads this net
+ * @param pin Input pin that was unwired
+ */
+void Net::RemoveSink(Pin* pin)
+{
+    mSinks.erase(remove(mSinks.begin(), mSinks.end(), pin), mSinks.end());
+}
@@ -0,0 +1,74 @@
+/**
+ * @file Net.h
+ * @author Ethan Springer, Daksh Mehta, Sehaj Gupta, Lukas Schaefer, Jack McNamara
+ *
+ * The signal on a wire from one output pin to any number of input pins
+ */
+
+#ifndef NET_H
+#define NET_H
+
+#include <vector>
+#include "Pin.h"
+
+/**
+ * The signal on a wire from one output pin to any number of input pins.
+ *
+ * Every output pin drives its own net, and an input pin wired to
+ * that output reads its state from the net. The driver writes
+ * the state once and the inputs never hold a copy of it, so a
+ * change reaches every input without being passed pin to pin.
+ * Only the gates of the inputs are told about the change, so
+ * they can be calculated again.
+ */
+class Net
+{
+private:
+    /// The state of the signal
+    PinState mState;
+
+    /// The output pin that writes the state, nullptr once it is gone
+    Pin* mDriver;
+
+    /// The input pins reading the state
+    std::vector<Pin*> mSinks;
+
+public:
+    Net(Pin* driver, PinState state);
+
+    /// Copy constructor (disabled)
+    Net(const Net&) = delete;
+
+    /// Assignment operator (disabled)
+    void operator=(const Net&) = delete;
+
+    void SetState(PinState state);
+    void AddSink(Pin* pin);
+    void RemoveSink(Pin* pin);
+
+    /**
+     * Get the state of the signal
+     * @return The state written by the driver
+     */
+    PinState GetState() const { return mState; }
+
+    /**
+     * Get the pin driving this net
+     * @return The output pin, nullptr if it has been destroyed
+     */
+    Pin* GetDriver() const { return mDriver; }
+
+    /**
+     * Forget the driver when it is destroyed
+     */
+    void ClearDriver() { mDriver = nullptr; }
+
+    /**
+     * Get the input pins reading this net
+     * @return The input pins
+     */
+    const std::vector<Pin*>& GetSinks() const { return mSinks; }
+};
+
+
+#endif //NET_H
@@ -0,0 +1,1202 @@
+/**
+ * @file Netlist.cpp
+ * @author Ethan Springer, Daksh Mehta, Sehaj Gupta, Lukas Schaefer, Jack McNamara
+ */
+
+#include "pch.h"
+#include "Netlist.h"
+#include "Gate.h"
+#include "Pin.h"
+#include "Net.h"
+#include <algorithm>
+#include <map>
+#include <unordered_map>
+
+using namespace std;
+
+/**
+ * Destructor
+ *
+ * Detaches the gates that are still in the circuit
+ */
+Netlist::~Netlist()
+{
+    Clear();
+}
+
+/**
+ * Add a gate to the circuit
+ *
+ * The gate is calculated on the next Evaluate
+ * @param gate Gate to add
+ */
+void Netlist::AddGate(Gate* gate)
+{
+    mGates.push_back(gate);
+    gate->SetNetlist(this);
+    Invalidate();
+    MarkDirty(gate);
+}
+
+/**
+ * Remove a gate and all of its dependencies from the circuit
+ * @param gate Gate to remove
+ */
+void Netlist::RemoveGate(Gate* gate)
+{
+    auto loc = find(mGates.begin(), mGates.end(), gate);
+    if (loc == mGates.end())
+    {
+        return;
+    }
+
+    mGates.erase(loc);
+    mGraph.RemoveGate(gate);
+    gate->SetNetlist(nullptr);
+    gate->SetDirty(false);
+    gate->SetLoop(-1);
+    gate->SetRole(GateRole::Evaluated);
+    gate->SetCluster(-1);
+    mWheel.Cancel(gate);
+    Invalidate();
+}
+
+/**
+ * Record a wire from an output pin to an input pin
+ * @param output Pin driving the wire
+ * @param input Pin the wire was dropped on
+ */
+void Netlist::Connect(Pin* output, Pin* input)
+{
+    // Outputs of a sequential gate only change after the tick has settled
+    Gate* source = output->getSourceGate();
+    Gate* dependent = input->getSourceGate();
+    if (source && dependent && !source->IsSequential())
+    {
+        mGraph.AddDependency(source, dependent);
+    }
+
+    // A wire to Sparty or from a beam changes what is dead or constant
+    Invalidate();
+}
+
+/**
+ * Record that a wire from an output pin to an input pin was removed
+ * @param output Pin that was driving the wire
+ * @param input Pin the wire was connected to
+ */
+void Netlist::Disconnect(Pin* output, Pin* input)
+{
+    Gate* source = output->getSourceGate();
+    Gate* dependent = input->getSourceGate();
+    if (source && dependent && !source->IsSequential())
+    {
+        mGraph.RemoveDependency(source, dependent);
+    }
+    Invalidate();
+}
+
+/**
+ * Remove all the gates and wires from the circuit
+ */
+void Netlist::Clear()
+{
+    Invalidate();
+    for (Gate* gate : mGates)
+    {
+        gate->SetNetlist(nullptr);
+        gate->SetDirty(false);
+        gate->SetLoop(-1);
+        gate->SetRole(GateRole::Evaluated);
+        gate->SetCluster(-1);
+    }
+    mGates.clear();
+    mDirty.clear();
+    mDirtySequential.clear();
+    mSequential.clear();
+    mClocks.clear();
+    mTimedDirty.clear();
+    mWheel.Clear();
+    mGraph.Clear();
+    mLevels.clear();
+    mMerged.clear();
+    mTables.clear();
+    mLevelTables.clear();
+    mDirtyTables.clear();
+    mLoops.clear();
+    mOrder.clear();
+    mOrderValid = true;
+}
+
+/**
+ * Note that the wiring changed.
+ *
+ * The levels are recomputed and the network compiled
+ * again the next time they are needed. A compiled network
+ * hands its remembered states back to the gates first.
+ */
+void Netlist::Invalidate()
+{
+    mOrderValid = false;
+    if (mCompiled.IsLoaded())
+    {
+        mCompiled.Unload();
+    }
+}
+
+/**
+ * Select how Evaluate computes the gates
+ * @param mode The new evaluation mode
+ */
+void Netlist::SetMode(EvaluationMode mode)
+{
+    if (mode == mMode)
+    {
+        return;
+    }
+
+    if (mCompiled.IsLoaded())
+    {
+        mCompiled.Unload();
+    }
+
+    // Timed mode keeps its own dirty list, so sort the waiting gates again
+    EvaluationMode old = mMode;
+    mMode = mode;
+    if (old == EvaluationMode::Timed || mode == EvaluationMode::Timed)
+    {
+        Invalidate();
+    }
+
+    // Changes still waiting for their delay happen now
+    if (old == EvaluationMode::Timed)
+    {
+        FlushEvents();
+    }
+}
+
+/**
+ * Turn optimization of the schedule on or off
+ * @param optimize True to leave out dead, constant and duplicate gates
+ */
+void Netlist::SetOptimize(bool optimize)
+{
+    if (optimize != mOptimize)
+    {
+        mOptimize = optimize;
+        Invalidate();
+    }
+}
+
+/**
+ * Group the combinational gates into logic levels, find
+ * the feedback loops and cache the result
+ */
+void Netlist::Schedule()
+{
+    vector<Gate*> combinational;
+    mSequential.clear();
+    for (Gate* gate : mGates)
+    {
+        gate->SetLoop(-1);
+        gate->SetLevel(0);
+        gate->SetCluster(-1);
+
+        // A gate left out of the last schedule may be out of date
+        if (gate->GetRole() != GateRole::Evaluated)
+        {
+            gate->SetRole(GateRole::Evaluated);
+            gate->SetDirty(true);
+        }
+
+        if (gate->IsSequential())
+        {
+            mSequential.push_back(gate);
+        }
+        else
+        {
+            combinational.push_back(gate);
+        }
+    }
+
+    mLevels = mGraph.Levelize(combinational);
+    mLoops = mGraph.FindLoops(combinational);
+    for (size_t loop = 0; loop < mLoops.size(); loop++)
+    {
+        for (Gate* gate : mLoops[loop])
+        {
+            gate->SetLoop(loop);
+        }
+    }
+
+    for (size_t level = 0; level < mLevels.size(); level++)
+    {
+        for (Gate* gate : mLevels[level])
+        {
+            gate->SetLevel(level);
+        }
+    }
+
+    mClocks.clear();
+    for (Gate* gate : mSequential)
+    {
+        if (gate->GetInputPins().empty())
+        {
+            mClocks.push_back(gate);
+        }
+    }
+
+    mMerged.assign(mLevels.size(), {});
+    mTables.clear();
+    mLevelTables.assign(mLevels.size(), {});
+    if (mOptimize && mMode != EvaluationMode::Timed)
+    {
+        Optimize();
+    }
+
+    mOrder.clear();
+    for (auto& level : mLevels)
+    {
+        mOrder.insert(mOrder.end(), level.begin(), level.end());
+    }
+    mOrder.insert(mOrder.end(), mSequential.begin(), mSequential.end());
+
+    // Levels may have moved, so sort the waiting gates again
+    mDirtyTables.assign(mLevels.size(), {});
+    for (auto& table : mTables)
+    {
+        mDirtyTables[table->GetLevel()].push_back(table.get());
+    }
+    mDirty.assign(mLevels.size(), {});
+    mDirtySequential.clear();
+    mTimedDirty.clear();
+    for (Gate* gate : mGates)
+    {
+        if (gate->GetRole() != GateRole::Evaluated)
+        {
+            gate->SetDirty(false);
+        }
+    }
+
+    // Timed mode calculates the clocks every tick, the other modes
+    // only latch a clock that asked to be latched again
+    for (Gate* clock : mClocks)
+    {
+        clock->SetDirty(mMode != EvaluationMode::Timed);
+    }
+
+    for (Gate* gate : mOrder)
+    {
+        if (!gate->IsDirty())
+        {
+            continue;
+        }
+
+        if (mMode == EvaluationMode::Timed)
+        {
+            mTimedDirty.push_back(gate);
+        }
+        else if (gate->IsSequential())
+        {
+            mDirtySequential.push_back(gate);
+        }
+        else
+        {
+            mDirty[gate->GetLevel()].push_back(gate);
+        }
+    }
+    mOrderValid = true;
+}
+
+/**
+ * Find the gate driving an input pin
+ * @param input Input pin of a gate
+ * @return Gate in this netlist driving the pin, nullptr if
+ * the pin is unwired or driven by something else
+ */
+Gate* Netlist::DriverOf(const Pin* input) const
+{
+    Net* net = input->GetNet();
+    Pin* driver = net ? net->GetDriver() : nullptr;
+    Gate* gate = driver ? driver->getSourceGate() : nullptr;
+    return gate && gate->GetNetlist() == this ? gate : nullptr;
+}
+
+/**
+ * Does a gate drive a pin outside the netlist, such as Sparty's
+ * @param gate Gate to test
+ * @return True if an output of the gate is wired outside the netlist
+ */
+bool Netlist::DrivesOutside(const Gate* gate) const
+{
+    for (const auto& pin : gate->GetOutputPins())
+    {
+        for (Pin* sink : pin->GetNet()->GetSinks())
+        {
+            Gate* reader = sink->getSourceGate();
+            if (reader == nullptr || reader->GetNetlist() != this)
+            {
+                return true;
+            }
+        }
+    }
+    return false;
+}
+
+/**
+ * Take the gates that need no work out of the levels.
+ *
+ * Working back from the flip flops and the gates wired outside
+ * the netlist, every gate not reached is dead. A live gate is
+ * constant if all its inputs are unwired or driven by constant
+ * gates. Constant gates are calculated here, once. A gate with the same function and the
+ * same input nets as an earlier gate is merged into it.
+ *
+ * Gates in feedback loops are never folded or merged.
+ */
+void Netlist::Optimize()
+{
+    vector<Gate*> live;
+    for (Gate* gate : mGates)
+    {
+        if (gate->IsSequential() || DrivesOutside(gate))
+        {
+            live.push_back(gate);
+        }
+        else
+        {
+            gate->SetRole(GateRole::Dead);
+        }
+    }
+
+    for (size_t i = 0; i < live.size(); i++)
+    {
+        for (const auto& pin : live[i]->GetInputPins())
+        {
+            Gate* driver = DriverOf(pin.get());
+            if (driver && driver->GetRole() == GateRole::Dead)
+            {
+                driver->SetRole(GateRole::Evaluated);
+                live.push_back(driver);
+            }
+        }
+    }
+
+    // Levels are in order, so constants are known before the gates they drive
+    for (auto& level : mLevels)
+    {
+        for (Gate* gate : level)
+        {
+            if (gate->GetRole() != GateRole::Evaluated || gate->GetLoop() >= 0)
+            {
+                continue;
+            }
+
+            // A gate with any live input is not folded, even if another
+            // input is a constant UNKNOWN, or every change on the live
+            // input would fold the netlist again
+            bool allConstant = true;
+            for (const auto& pin : gate->GetInputPins())
+            {
+                Gate* driver = DriverOf(pin.get());
+                bool constant = pin->GetNet() == nullptr ||
+                    (driver && driver->GetRole() == GateRole::Constant);
+                allConstant = allConstant && constant;
+            }
+
+            if (allConstant)
+            {
+                gate->calculate();
+                gate->SetRole(GateRole::Constant);
+            }
+        }
+    }
+
+    // Every combinational function is symmetric in its inputs,
+    // so the input nets are compared in any order
+    map<pair<GateOp, vector<Net*>>, Gate*> kept;
+    for (size_t level = 0; level < mLevels.size(); level++)
+    {
+        for (Gate* gate : mLevels[level])
+        {
+            // A macro is not symmetric in its inputs and two may differ inside
+            if (gate->GetRole() != GateRole::Evaluated || gate->GetLoop() >= 0 || gate->GetOp() == GateOp::Macro)
+            {
+                continue;
+            }
+
+            pair<GateOp, vector<Net*>> key(gate->GetOp(), {});
+            for (const auto& pin : gate->GetInputPins())
+            {
+                key.second.push_back(pin->GetNet());
+            }
+            if (find(key.second.begin(), key.second.end(), nullptr) != key.second.end())
+            {
+                continue;
+            }
+            sort(key.second.begin(), key.second.end());
+
+            auto found = kept.emplace(key, gate);
+            if (!found.second)
+            {
+                gate->SetRole(GateRole::Merged);
+                mMerged[level].emplace_back(gate, found.first->second);
+            }
+        }
+        CopyMerged(level);
+
+        auto& gates = mLevels[level];
+        gates.erase(remove_if(gates.begin(), gates.end(),
+                              [](Gate* gate) { return gate->GetRole() != GateRole::Evaluated; }), gates.end());
+    }
+
+    if (mClusterInputs > 0)
+    {
+        BuildClusters();
+    }
+}
+
+/**
+ * Replace clusters of combinational gates with truth tables.
+ *
+ * Gates are in the same cluster if one drives the other or
+ * they read the same net, so a merged gate always ends up with
+ * the gate it copies. A cluster becomes a table if it has at
+ * least two gates, no more than the cluster input limit of
+ * inputs, and every gate outside reading its outputs is at a
+ * higher level than the cluster, so it can be evaluated as one
+ * after the level of its last gate.
+ */
+void Netlist::BuildClusters()
+{
+    // Place of each gate in candidates, indexed by the handle of the gate
+    const size_t none = SIZE_MAX;
+    size_t bound = 0;
+    for (Gate* gate : mGates)
+    {
+        bound = max<size_t>(bound, gate->GetHandle().GetIndex() + 1);
+    }
+    vector<Gate*> candidates;
+    vector<size_t> index(bound, none);
+    for (Gate* gate : mGates)
+    {
+        GateRole role = gate->GetRole();
+        if ((role == GateRole::Evaluated || role == GateRole::Merged) &&
+            gate->GetLoop() < 0 && !gate->IsSequential() && gate->GetOp() != GateOp::Macro)
+        {
+            index[gate->GetHandle().GetIndex()] = candidates.size();
+            candidates.push_back(gate);
+        }
+    }
+
+    vector<size_t> parent(candidates.size());
+    for (size_t i = 0; i < parent.size(); i++)
+    {
+        parent[i] = i;
+    }
+    auto root = [&parent](size_t i)
+    {
+        while (parent[i] != i)
+        {
+            parent[i] = parent[parent[i]];
+            i = parent[i];
+        }
+        return i;
+    };
+
+    unordered_map<Net*, size_t> firstReader;
+    for (size_t i = 0; i < candidates.size(); i++)
+    {
+        for (const auto& pin : candidates[i]->GetInputPins())
+        {
+            Gate* driver = DriverOf(pin.get());
+            size_t d = driver ? driver->GetHandle().GetIndex() : bound;
+            if (d < bound && index[d] != none)
+            {
+                parent[root(i)] = root(index[d]);
+            }
+
+            Net* net = pin->GetNet();
+            if (net)
+            {
+                auto reader = firstReader.emplace(net, i);
+                parent[root(i)] = root(reader.first->second);
+            }
+        }
+    }
+
+    // Gates of each cluster, lowest level first
+    vector<vector<Gate*>> clusters(candidates.size());
+    for (size_t i = 0; i < candidates.size(); i++)
+    {
+        clusters[root(i)].push_back(candidates[i]);
+    }
+
+    size_t maxInputs = min(mClusterInputs, TruthTable::MaxInputs);
+    for (size_t i = 0; i < candidates.size(); i++)
+    {
+        auto& gates = clusters[i];
+        if (gates.size() < 2)
+        {
+            continue;
+        }
+
+        stable_sort(gates.begin(), gates.end(),
+                    [](Gate* a, Gate* b) { return a->GetLevel() < b->GetLevel(); });
+        int level = gates.back()->GetLevel();
+
+        bool readersAfter = true;
+        for (Gate* gate : gates)
+        {
+            for (const auto& pin : gate->GetOutputPins())
+            {
+                for (Pin* sink : pin->GetNet()->GetSinks())
+                {
+                    Gate* reader = sink->getSourceGate();
+                    if (reader == nullptr || reader->GetNetlist() != this || reader->IsSequential() ||
+                        reader->GetRole() == GateRole::Dead)
+                    {
+                        continue;
+                    }
+
+                    size_t member = index[reader->GetHandle().GetIndex()];
+                    bool inside = member != none && root(member) == i;
+                    if (!inside && reader->GetLevel() <= level)
+                    {
+                        readersAfter = false;
+                    }
+                }
+            }
+        }
+
+        if (!readersAfter || TruthTable::CountInputs(gates) > maxInputs)
+        {
+            continue;
+        }
+
+        auto table = make_unique<TruthTable>(gates);
+        table->SetLevel(level);
+        for (Gate* gate : gates)
+        {
+            gate->SetRole(GateRole::Clustered);
+            gate->SetCluster(mTables.size());
+        }
+        mLevelTables[level].push_back(table.get());
+        mTables.push_back(move(table));
+    }
+
+    for (size_t level = 0; level < mLevels.size(); level++)
+    {
+        auto& gates = mLevels[level];
+        gates.erase(remove_if(gates.begin(), gates.end(),
+                              [](Gate* gate) { return gate->GetRole() == GateRole::Clustered; }), gates.end());
+        auto& merged = mMerged[level];
+        merged.erase(remove_if(merged.begin(), merged.end(),
+                               [](const pair<Gate*, Gate*>& pair) { return pair.first->GetRole() == GateRole::Clustered; }),
+                     merged.end());
+    }
+}
+
+/**
+ * Evaluate a group of truth tables from the same level
+ * @param tables Tables to evaluate
+ */
+void Netlist::EvaluateTables(vector<TruthTable*>& tables)
+{
+    for (TruthTable* table : tables)
+    {
+        // Still dirty while it runs, so its own outputs do not mark it again
+        table->Evaluate();
+        table->SetDirty(false);
+    }
+    mEvaluatedCount += tables.size();
+}
+
+/**
+ * Set the largest cluster replaced by a truth table
+ * @param inputs Most inputs of a cluster, 0 to never build tables
+ */
+void Netlist::SetClusterInputs(size_t inputs)
+{
+    if (inputs != mClusterInputs)
+    {
+        mClusterInputs = inputs;
+        Invalidate();
+    }
+}
+
+/**
+ * Copy the outputs of the gates merged into gates of a level
+ * @param level Level that was just calculated
+ */
+void Netlist::CopyMerged(size_t level)
+{
+    for (auto& merged : mMerged[level])
+    {
+        auto outputs = merged.first->GetOutputPins();
+        auto sources = merged.second->GetOutputPins();
+        for (size_t i = 0; i < outputs.size(); i++)
+        {
+            outputs[i]->SetState(sources[i]->GetState());
+        }
+    }
+}
+
+/**
+ * Mark a gate as needing to be calculated on the next Evaluate
+ * @param gate Gate with an input that changed
+ */
+void Netlist::MarkDirty(Gate* gate)
+{
+    // EvaluateParallel marks the gates itself once the level is done
+    if (mDeferMarks || gate->IsDirty())
+    {
+        return;
+    }
+
+    // Timed mode calculates the clocks at the start of every tick
+    if (mMode == EvaluationMode::Timed && gate->IsSequential() && gate->GetInputPins().empty())
+    {
+        return;
+    }
+
+    switch (gate->GetRole())
+    {
+    case GateRole::Evaluated:
+        break;
+
+    case GateRole::Constant:
+        // Something set an unwired input, so fold again
+        Invalidate();
+        break;
+
+    case GateRole::Clustered:
+        // The truth table of the cluster is evaluated instead
+        if (mOrderValid)
+        {
+            TruthTable* table = mTables[gate->GetCluster()].get();
+            if (!table->IsDirty())
+            {
+                table->SetDirty(true);
+                mDirtyTables[table->GetLevel()].push_back(table);
+            }
+        }
+        return;
+
+    default:
+        // Dead gates are not calculated and merged gates are copied
+        return;
+    }
+
+    gate->SetDirty(true);
+
+    // When the levels are out of date Schedule picks up the flag
+    if (!mOrderValid)
+    {
+        return;
+    }
+
+    if (mMode == EvaluationMode::Timed)
+    {
+        mTimedDirty.push_back(gate);
+    }
+    else if (gate->IsSequential())
+    {
+        mDirtySequential.push_back(gate);
+    }
+    else
+    {
+        mDirty[gate->GetLevel()].push_back(gate);
+    }
+}
+
+/**
+ * Change an output pin once the delay of its gate has passed
+ * @param pin Output pin of a gate in timed mode
+ * @param state State to set it to
+ * @param delay Time units until the change
+ */
+void Netlist::ScheduleOutput(Pin* pin, PinState state, int delay)
+{
+    mWheel.Schedule(delay, pin, state);
+}
+
+/**
+ * Get the order to evaluate the gates in.
+ *
+ * The combinational gates come first, level by level,
+ * followed by the sequential gates. Only sorts the gates again if the circuit changed
+ * since the last call.
+ * @return Gates in evaluation order
+ */
+const std::vector<Gate*>& Netlist::GetEvaluationOrder()
+{
+    if (!mOrderValid)
+    {
+        Schedule();
+    }
+    return mOrder;
+}
+
+/**
+ * Get the combinational gates grouped by logic level.
+ *
+ * Every gate only reads outputs of gates in lower levels,
+ * so the gates within a level are independent of each other.
+ * @return Gates of each level, lowest level first
+ */
+const std::vector<std::vector<Gate*>>& Netlist::GetLevels()
+{
+    if (!mOrderValid)
+    {
+        Schedule();
+    }
+    return mLevels;
+}
+
+/**
+ * Get the feedback loops in the circuit
+ * @return Gates of each loop, indexed by Gate::GetLoop
+ */
+const std::vector<std::vector<Gate*>>& Netlist::GetLoops()
+{
+    if (!mOrderValid)
+    {
+        Schedule();
+    }
+    return mLoops;
+}
+
+/**
+ * Calculate a group of gates from the same level.
+ *
+ * Gates that are not in a loop are calculated once, and every
+ * loop with a gate in the group is settled.
+ * @param gates Gates to calculate
+ */
+void Netlist::EvaluateLevel(const std::vector<Gate*>& gates)
+{
+    bool parallel = mPool && gates.size() >= mParallelThreshold;
+    for (Gate* gate : gates)
+    {
+        int loop = gate->GetLoop();
+        if (loop < 0)
+        {
+            if (parallel)
+            {
+                mParallelGates.push_back(gate);
+            }
+            else
+            {
+                gate->calculate();
+                mEvaluatedCount++;
+            }
+        }
+        else if (find(mPendingLoops.begin(), mPendingLoops.end(), loop) == mPendingLoops.end())
+        {
+            mPendingLoops.push_back(loop);
+        }
+    }
+
+    if (parallel)
+    {
+        EvaluateParallel();
+    }
+
+    for (int loop : mPendingLoops)
+    {
+        SettleLoop(mLoops[loop]);
+    }
+    mPendingLoops.clear();
+}
+
+/**
+ * Calculate the gates in mParallelGates on the thread pool.
+ *
+ * While the threads run, the gates reading the outputs are not
+ * marked, since that would have every thread changing the dirty
+ * lists. Afterwards the outputs are compared with their states
+ * from before, and the gates reading the ones that changed are
+ * marked in order, so the result does not depend on the timing
+ * of the threads.
+ */
+void Netlist::EvaluateParallel()
+{
+    mParallelStates.clear();
+    for (Gate* gate : mParallelGates)
+    {
+        for (const auto& pin : gate->GetOutputPins())
+        {
+            mParallelStates.push_back(pin->GetState());
+        }
+    }
+
+    mDeferMarks = true;
+    mPool->ParallelFor(mParallelGates.size(), ParallelGrain, [this](size_t begin, size_t end)
+    {
+        for (size_t i = begin; i < end; i++)
+        {
+            mParallelGates[i]->calculate();
+        }
+    });
+    mDeferMarks = false;
+    mEvaluatedCount += mParallelGates.size();
+
+    size_t i = 0;
+    for (Gate* gate : mParallelGates)
+    {
+        for (const auto& pin : gate->GetOutputPins())
+        {
+            if (pin->GetState() == mParallelStates[i++])
+            {
+                continue;
+            }
+
+            for (Pin* sink : pin->GetNet()->GetSinks())
+            {
+                if (sink->getSourceGate())
+                {
+                    sink->getSourceGate()->OnInputChanged();
+                }
+            }
+        }
+    }
+    mParallelGates.clear();
+}
+
+/**
+ * Set the number of threads large levels are calculated on
+ * @param threads Number of threads, 1 or 0 to calculate every level serially
+ */
+void Netlist::SetThreadCount(unsigned threads)
+{
+    if (threads == GetThreadCount())
+    {
+        return;
+    }
+
+    mPool.reset();
+    if (threads > 1)
+    {
+        mPool = std::make_unique<ThreadPool>(threads);
+    }
+}
+
+/**
+ * Calculate the gates of a feedback loop until its outputs stop changing.
+ *
+ * A loop that is still changing after MaxLoopIterations passes
+ * has no stable state, so its outputs are set to UNKNOWN. Either
+ * way the loop is finished for this Evaluate.
+ * @param loop Gates of the loop
+ */
+void Netlist::SettleLoop(const std::vector<Gate*>& loop)
+{
+    bool settled = false;
+    for (int pass = 0; pass < MaxLoopIterations && !settled; pass++)
+    {
+        mLoopStates.clear();
+        for (Gate* gate : loop)
+        {
+            for (const auto& pin : gate->GetOutputPins())
+            {
+                mLoopStates.push_back(pin->GetState());
+            }
+        }
+
+        for (Gate* gate : loop)
+        {
+            gate->calculate();
+        }
+        mEvaluatedCount += loop.size();
+
+        settled = true;
+        size_t i = 0;
+        for (Gate* gate : loop)
+        {
+            for (const auto& pin : gate->GetOutputPins())
+            {
+                settled = settled && pin->GetState() == mLoopStates[i++];
+            }
+        }
+    }
+
+    if (!settled)
+    {
+        for (Gate* gate : loop)
+        {
+            for (const auto& pin : gate->GetOutputPins())
+            {
+                pin->SetState(PinState::UNKNOWN);
+            }
+        }
+    }
+
+    // Changes inside the loop have all been calculated
+    for (Gate* gate : loop)
+    {
+        gate->SetDirty(false);
+    }
+}
+
+/**
+ * Calculate the gates waiting in the dirty lists, one level at a time.
+ *
+ * Gates marked by lower levels during the pass are picked up
+ * when their own level is reached.
+ */
+void Netlist::EvaluateDirty()
+{
+    for (size_t level = 0; level < mDirty.size(); level++)
+    {
+        mEvaluating.swap(mDirty[level]);
+        for (Gate* gate : mEvaluating)
+        {
+            gate->SetDirty(false);
+        }
+        if (!mEvaluating.empty())
+        {
+            EvaluateLevel(mEvaluating);
+            mEvaluating.clear();
+            CopyMerged(level);
+        }
+
+        if (!mDirtyTables[level].empty())
+        {
+            mEvaluatingTables.swap(mDirtyTables[level]);
+            EvaluateTables(mEvaluatingTables);
+            mEvaluatingTables.clear();
+        }
+
+        // Drop loop gates that were marked again and then settled
+        auto& waiting = mDirty[level];
+        waiting.erase(remove_if(waiting.begin(), waiting.end(),
+                                [](Gate* gate) { return !gate->IsDirty(); }), waiting.end());
+    }
+}
+
+/**
+ * Latch the sequential gates.
+ *
+ * Every gate samples its inputs before any gate commits, so a
+ * flip flop reading the output of another flip flop sees the
+ * state from before this tick. Sampling only reads pins and
+ * changes the gate's own state, so a large set of gates is
+ * sampled on the thread pool. In event driven mode only gates
+ * with an input that changed are latched.
+ *
+ * A gate whose input changes during the commit, even its own
+ * output fed back, is sampled again on the next tick.
+ */
+void Netlist::Latch()
+{
+    for (Gate* gate : mDirtySequential)
+    {
+        gate->SetDirty(false);
+    }
+    if (mMode == EvaluationMode::EventDriven)
+    {
+        mLatching.swap(mDirtySequential);
+    }
+    else
+    {
+        mLatching = mSequential;
+    }
+    mDirtySequential.clear();
+
+    if (mPool && mLatching.size() >= mParallelThreshold)
+    {
+        mPool->ParallelFor(mLatching.size(), ParallelGrain, [this](size_t begin, size_t end)
+        {
+            for (size_t i = begin; i < end; i++)
+            {
+                mLatching[i]->Sample();
+            }
+        });
+    }
+    else
+    {
+        for (Gate* gate : mLatching)
+        {
+            gate->Sample();
+        }
+    }
+
+    for (Gate* gate : mLatching)
+    {
+        gate->Commit();
+    }
+    mEvaluatedCount += mLatching.size();
+    mLatching.clear();
+}
+
+/**
+ * Run one clock tick of the circuit.
+ *
+ * The combinational gates are computed one logic level at a
+ * time. Because every gate comes after the gates driving it, a
+ * combinational circuit settles in this single pass. In event
+ * driven mode a gate is only calculated if one of its inputs
+ * changed, which includes changes made by lower levels during
+ * this pass. Feedback loops are settled within their level.
+ *
+ * In compiled mode the combinational network is compiled on
+ * the first Evaluate after the wiring changed and then run as
+ * a whole. A network with feedback loops is evaluated by level
+ * instead.
+ *
+ * The sequential gates are then latched together, and the
+ * gates reading outputs they changed are calculated again.
+ *
+ * In timed mode the tick is TimeUnitsPerTick time units of
+ * delayed changes instead.
+ */
+void Netlist::Evaluate()
+{
+    if (!mOrderValid)
+    {
+        Schedule();
+    }
+
+    mEvaluatedCount = 0;
+    if (mMode == EvaluationMode::Timed)
+    {
+        EvaluateTimed();
+        return;
+    }
+
+    if (mMode == EvaluationMode::EventDriven)
+    {
+        EvaluateDirty();
+    }
+    else
+    {
+        // The compiled program runs each gate once, so it cannot settle loops
+        if (mMode == EvaluationMode::Compiled && mLoops.empty())
+        {
+            if (!mCompiled.IsLoaded())
+            {
+                // The program reads pins only at the start of a run, so merged and
+                // clustered gates are compiled rather than copied afterwards
+                vector<vector<Gate*>> clustered(mLevels.size());
+                for (auto& table : mTables)
+                {
+                    for (Gate* gate : table->GetGates())
+                    {
+                        clustered[gate->GetLevel()].push_back(gate);
+                    }
+                }
+
+                vector<Gate*> program;
+                for (size_t level = 0; level < mLevels.size(); level++)
+                {
+                    program.insert(program.end(), mLevels[level].begin(), mLevels[level].end());
+                    for (auto& merged : mMerged[level])
+                    {
+                        program.push_back(merged.first);
+                    }
+                    program.insert(program.end(), clustered[level].begin(), clustered[level].end());
+                }
+                mCompiled.Compile(program);
+            }
+            mCompiled.Run();
+            mEvaluatedCount = mCompiled.GetProgram().size();
+        }
+        else
+        {
+            for (size_t level = 0; level < mLevels.size(); level++)
+            {
+                EvaluateLevel(mLevels[level]);
+                CopyMerged(level);
+                EvaluateTables(mLevelTables[level]);
+            }
+        }
+
+        for (auto& level : mDirty)
+        {
+            for (Gate* gate : level)
+            {
+                gate->SetDirty(false);
+            }
+            level.clear();
+        }
+        for (auto& level : mDirtyTables)
+        {
+            for (TruthTable* table : level)
+            {
+                table->SetDirty(false);
+            }
+            level.clear();
+        }
+    }
+
+    if (!mSequential.empty())
+    {
+        Latch();
+        EvaluateDirty();
+    }
+}
+
+/**
+ * Run one tick of the circuit in timed mode.
+ *
+ * The clocks and any gate with an input changed from outside
+ * are calculated first. Then, one time unit at a time, the
+ * output changes due in that unit are made and the gates they
+ * reach are calculated, putting their own output changes on
+ * the wheel. The tick ends early once nothing is waiting.
+ */
+void Netlist::EvaluateTimed()
+{
+    for (Gate* clock : mClocks)
+    {
+        clock->calculate();
+    }
+    mEvaluatedCount += mClocks.size();
+    EvaluateTimedDirty();
+
+    for (int unit = 0; unit < TimeUnitsPerTick && !mWheel.IsEmpty(); unit++)
+    {
+        mWheel.Advance(mEvents);
+        for (auto& event : mEvents)
+        {
+            event.pin->SetState(event.state);
+        }
+        mEvents.clear();
+        EvaluateTimedDirty();
+    }
+}
+
+/**
+ * Calculate the gates with an input that changed in this time unit.
+ *
+ * A gate only puts changes on the wheel, so no input changes
+ * while the gates are calculated.
+ */
+void Netlist::EvaluateTimedDirty()
+{
+    mEvaluating.swap(mTimedDirty);
+    for (Gate* gate : mEvaluating)
+    {
+        gate->SetDirty(false);
+    }
+    for (Gate* gate : mEvaluating)
+    {
+        gate->calculate();
+    }
+    mEvaluatedCount += mEvaluating.size();
+    mEvaluating.clear();
+}
+
+/**
+ * Make every change waiting on the wheel, earliest first
+ */
+void Netlist::FlushEvents()
+{
+    mWheel.Flush(mEvents);
+    for (auto& event : mEvents)
+    {
+        event.pin->SetState(event.state);
+    }
+    mEvents.clear();
+}
@@ -0,0 +1,307 @@
+/**
+ * @file Netlist.h
+ * @author Ethan Springer, Daksh Mehta, Sehaj Gupta, Lukas Schaefer, Jack McNamara
+ *
+ * The wiring of all the gates in a game
+ */
+
+#ifndef NETLIST_H
+#define NETLIST_H
+
+#include <memory>
+#include <vector>
+#include "DependencyGraph.h"
+#include "CompiledCircuit.h"
+#include "Pin.h"
+#include "ThreadPool.h"
+#include "TruthTable.h"
+#include "TimingWheel.h"
+
+class Gate;
+
+/**
+ * The wiring of all the gates in a game.
+ *
+ * The netlist is kept up to date as gates are added and removed
+ * and as wires are connected and disconnected. Each gate is
+ * assigned a logic level from the wires driving it, and the
+ * levels are cached and only recomputed after one of those
+ * events, not on every update.
+ *
+ * In event driven mode (the default) only gates with an input
+ * that changed are calculated, along with whatever they change
+ * downstream, one level at a time. In compiled mode the whole
+ * network runs as a CompiledCircuit, which is compiled again
+ * only after the wiring changes.
+ *
+ * A feedback loop, such as a latch made from NAND gates, is
+ * calculated over and over until its outputs stop changing. A
+ * loop that has not settled after MaxLoopIterations passes is
+ * oscillating, and its outputs are set to UNKNOWN.
+ *
+ * With more than one thread, levels with at least the parallel
+ * threshold of gates are calculated on a thread pool. The gates
+ * of a level only read outputs of lower levels, so the results
+ * are the same as calculating them one at a time.
+ *
+ * Each Evaluate is one clock tick. The combinational gates
+ * settle first, then every sequential gate (flip flop) samples
+ * its inputs, and only after all of them have sampled do they
+ * commit their new outputs. The gates those outputs drive then
+ * settle again. Each sequential gate is sampled at most once
+ * per tick, so a shift register moves one place per tick no
+ * matter what order the flip flops were added in.
+ *
+ * With optimization on, the schedule leaves out gates that need
+ * no work: dead gates whose outputs reach nothing outside the
+ * netlist, constant gates whose inputs cannot change, and gates
+ * that duplicate another gate with the same function and input
+ * nets. Like the levels, this is only worked out again after
+ * the wiring changes.
+ *
+ * Optimization also looks for clusters of combinational gates
+ * with no more than the cluster input limit of inputs, and
+ * replaces each with a TruthTable evaluated after the level of
+ * its last gate. The tables are built again whenever the
+ * schedule is.
+ *
+ * In timed mode each gate has a propagation delay, and a change
+ * to an output is put on a TimingWheel and only reaches the pin
+ * that many time units later. A tick is TimeUnitsPerTick units
+ * long, and in each unit only the gates with an input that just
+ * changed are calculated, so short pulses from unequal paths
+ * (glitches) reach the gates after them and a quiet circuit
+ * costs nothing. The clocks are calculated once at the start of
+ * each tick. Timed mode is not optimized.
+ */
+class Netlist
+{
+public:
+    /// How Evaluate computes the gates
+    enum class EvaluationMode
+    {
+        /// Calculate every gate in level order
+        Full,
+        /// Only calculate gates with an input that changed
+        EventDriven,
+        /// Run the compiled instruction stream
+        Compiled,
+        /// Delay each output change by the propagation delay of its gate
+        Timed
+    };
+
+    /// Most passes over a feedback loop before it is taken to be oscillating
+    static const int MaxLoopIterations = 32;
+
+    /// Time units in one tick in timed mode
+    static const int TimeUnitsPerTick = 16;
+
+    /// Default largest number of inputs of a cluster replaced by a truth table
+    static const size_t DefaultClusterInputs = 10;
+
+    /// Default smallest level worth calculating in parallel
+    static const size_t DefaultParallelThreshold = 1024;
+
+    /// Gates each thread pool task calculates
+    static const size_t ParallelGrain = 256;
+
+private:
+    /// All the gates in the circuit, in the order they were added
+    std::vector<Gate*> mGates;
+
+    /// Dependencies between the gates
+    DependencyGraph mGraph;
+
+    /// Cached logic levels, lowest level first
+    std::vector<std::vector<Gate*>> mLevels;
+
+    /// Cached order to evaluate the gates in, the levels
+    /// flattened and then the sequential gates
+    std::vector<Gate*> mOrder;
+
+    /// Cached sequential gates, in the order they were added
+    std::vector<Gate*> mSequential;
+
+    /// Sequential gates with an input that changed since they last sampled
+    std::vector<Gate*> mDirtySequential;
+
+    /// Sequential gates being latched in the current tick
+    std::vector<Gate*> mLatching;
+
+    /// Cached merged gates of each level, each paired with
+    /// the gate whose outputs it copies
+    std::vector<std::vector<std::pair<Gate*, Gate*>>> mMerged;
+
+    /// Cached truth tables of the gate clusters, indexed by Gate::GetCluster
+    std::vector<std::unique_ptr<TruthTable>> mTables;
+
+    /// Cached truth tables of each level
+    std::vector<std::vector<TruthTable*>> mLevelTables;
+
+    /// Truth tables waiting to be evaluated, by logic level
+    std::vector<std::vector<TruthTable*>> mDirtyTables;
+
+    /// Truth tables of the level being evaluated
+    std::vector<TruthTable*> mEvaluatingTables;
+
+    /// Largest number of inputs of a cluster replaced by a truth table, 0 for none
+    size_t mClusterInputs = DefaultClusterInputs;
+
+    /// Cached feedback loops, indexed by Gate::GetLoop
+    std::vector<std::vector<Gate*>> mLoops;
+
+    /// Loops with a gate in the level being calculated
+    std::vector<int> mPendingLoops;
+
+    /// Output states of a loop before the last pass over it
+    std::vector<PinState> mLoopStates;
+
+    /// True if mLevels and mOrder match the current wiring
+    bool mOrderValid = true;
+
+    /// Gates waiting to be calculated, by logic level
+    std::vector<std::vector<Gate*>> mDirty;
+
+    /// The level of gates currently being calculated
+    std::vector<Gate*> mEvaluating;
+
+    /// How Evaluate computes the gates
+    EvaluationMode mMode = EvaluationMode::EventDriven;
+
+    /// The network compiled for EvaluationMode::Compiled
+    CompiledCircuit mCompiled;
+
+    /// True if the schedule leaves out dead, constant and duplicate gates
+    bool mOptimize = false;
+
+    /// Number of gates calculated by the last Evaluate
+    size_t mEvaluatedCount = 0;
+
+    /// Output changes waiting for their delay in timed mode
+    TimingWheel mWheel;
+
+    /// Gates with an input that changed in the current time unit, in timed mode
+    std::vector<Gate*> mTimedDirty;
+
+    /// Output changes due in the current time unit
+    std::vector<TimingWheel::Event> mEvents;
+
+    /// Cached clocks, the sequential gates with no inputs
+    std::vector<Gate*> mClocks;
+
+    /// Threads to calculate large levels on, nullptr to run serially
+    std::unique_ptr<ThreadPool> mPool;
+
+    /// Smallest level calculated on the thread pool
+    size_t mParallelThreshold = DefaultParallelThreshold;
+
+    /// True while a level is calculated in parallel, so MarkDirty waits
+    bool mDeferMarks = false;
+
+    /// Gates of the level being calculated in parallel
+    std::vector<Gate*> mParallelGates;
+
+    /// Output states of mParallelGates before they were calculated
+    std::vector<PinState> mParallelStates;
+
+    void Schedule();
+    void Optimize();
+    void CopyMerged(size_t level);
+    void BuildClusters();
+    void EvaluateTables(std::vector<TruthTable*>& tables);
+    Gate* DriverOf(const Pin* input) const;
+    bool DrivesOutside(const Gate* gate) const;
+    void Invalidate();
+    void EvaluateLevel(const std::vector<Gate*>& gates);
+    void SettleLoop(const std::vector<Gate*>& loop);
+    void EvaluateParallel();
+    void EvaluateDirty();
+    void Latch();
+    void EvaluateTimed();
+    void EvaluateTimedDirty();
+    void FlushEvents();
+
+public:
+    Netlist() = default;
+    Netlist(const Netlist&) = delete;
+    void operator=(const Netlist&) = delete;
+    ~Netlist();
+
+    void AddGate(Gate* gate);
+    void RemoveGate(Gate* gate);
+    void Connect(Pin* output, Pin* input);
+    void Disconnect(Pin* output, Pin* input);
+    void Clear();
+    void MarkDirty(Gate* gate);
+    void ScheduleOutput(Pin* pin, PinState state, int delay);
+
+    const std::vector<Gate*>& GetEvaluationOrder();
+    const std::vector<std::vector<Gate*>>& GetLevels();
+    const std::vector<std::vector<Gate*>>& GetLoops();
+    void Evaluate();
+
+    /**
+     * Get all the gates in the circuit
+     * @return Gates in the order they were added
+     */
+    const std::vector<Gate*>& GetGates() const { return mGates; }
+
+    void SetMode(EvaluationMode mode);
+
+    /**
+     * Get how Evaluate computes the gates
+     * @return The evaluation mode
+     */
+    EvaluationMode GetMode() const { return mMode; }
+
+    /**
+     * Get the compiled network
+     * @return The compiled circuit, only loaded in compiled mode
+     */
+    const CompiledCircuit& GetCompiled() const { return mCompiled; }
+
+    void SetOptimize(bool optimize);
+
+    /**
+     * Does the schedule leave out gates that need no work
+     * @return True if optimization is on
+     */
+    bool IsOptimized() const { return mOptimize; }
+
+    void SetClusterInputs(size_t inputs);
+
+    /**
+     * Get the truth tables replacing gate clusters
+     * @return Tables, indexed by Gate::GetCluster
+     */
+    const std::vector<std::unique_ptr<TruthTable>>& GetTables() const { return mTables; }
+
+    /**
+     * Get the output changes waiting in timed mode
+     * @return The timing wheel
+     */
+    const TimingWheel& GetWheel() const { return mWheel; }
+
+    void SetThreadCount(unsigned threads);
+
+    /**
+     * Get the number of threads large levels are calculated on
+     * @return Number of threads, 1 if serial
+     */
+    unsigned GetThreadCount() const { return mPool ? mPool->GetThreadCount() : 1; }
+
+    /**
+     * Set the smallest level worth calculating in parallel
+     * @param threshold Number of gates
+     */
+    void SetParallelThreshold(size_t threshold) { mParallelThreshold = threshold; }
+
+    /**
+     * Get how much work the last Evaluate did
+     * @return Number of gates calculated by the last Evaluate
+     */
+    size_t GetEvaluatedCount() const { return mEvaluatedCount; }
+};
+
+
+#endif //NETLIST_H
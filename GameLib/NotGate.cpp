@@ -4,6 +4,7 @@
  */
 #include "pch.h"
 #include "NotGate.h"
+#include "Game.h"
 
 using namespace std;
 /// Size of the Not gate in pixels
@@ -18,11 +19,11 @@ const double WidthConst = 12.8;
 
 NotGate::NotGate(Game* game) : Gate(game)
 {
-	auto inputPin1 = make_shared<Pin>(game, PinType::INPUT, -mSize.GetWidth() * Half, 0);
-	auto outputPin1 = make_shared<Pin>(game, PinType::OUTPUT, mSize.GetWidth() - WidthConst, 0);
+	auto inputPin1 = game->MakePin(PinType::INPUT, -mSize.GetWidth() * Half, 0);
+	auto outputPin1 = game->MakePin(PinType::OUTPUT, mSize.GetWidth() - WidthConst, 0);
 
-	mPins.push_back(inputPin1);
-	mPins.push_back(outputPin1);
+	AddPin(inputPin1);
+	AddPin(outputPin1);
 }
 
 
@@ -74,13 +75,13 @@ void NotGate::Draw(std::shared_ptr<wxGraphicsContext> graphics)
  */
 void NotGate::calculate()
 {
-	vector<shared_ptr<Pin>> InputPins = GetInputPins();
+	PinSpan InputPins = GetInputPins();
 
 	if (InputPins.size() > 0 && InputPins[0])
 	{
 		PinState A = InputPins[0]->GetState();
 
-		shared_ptr<Pin> OutputPin = GetOutputPins()[0];
+		const shared_ptr<Pin>& OutputPin = GetOutputPins()[0];
 
 		if (A == PinState::ZERO)
 		{
@@ -37,6 +37,18 @@ public:
 
 	void calculate() override;
 
+	/**
+	 * Get the logic function of this gate
+	 * @return GateOp::Not
+	 */
+	GateOp GetOp() const override { return GateOp::Not; }
+
+	/**
+	 * Get the propagation delay of this gate
+	 * @return 1 time unit
+	 */
+	int GetDelay() const override { return 1; }
+
 	/**
 	* virtual function to get size of gate
 	* @return size of gate
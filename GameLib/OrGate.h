@@ -7,44 +7,68 @@
 
 #ifndef ORGATE_H
 #define ORGATE_H
-#include "Gate.h"
-#include "Item.h"
-#include "Pin.h"
+#include "LogicGate.h"
 
 /**
- * class for or gate inherits from gate
+ * The OR function and shape for LogicGate
  */
-class OrGate : public Gate
+struct OrOp
 {
-private:
-	/// Size of the Or gate in pixels
-	const wxSize mSize = wxSize(75, 50);
+	/// Operation the circuit compiler emits
+	static constexpr GateOp Op = GateOp::Or;
 
-	/// Vector to hold 3 pins of And Gate
-	//std::vector<std::shared_ptr<Pin>> mPins;
+	/// Propagation delay of the OR gate in time units
+	static constexpr int Delay = 2;
 
-public:
-	// deleting default constructors
-	OrGate() = delete;
-	OrGate(const OrGate& gate) = delete;
-	void operator=(const OrGate& gate) = delete;
+	/// Width of the two input OR gate in pixels
+	static constexpr int Width = 75;
 
-	/**
-	* constructor for not gate
-	* @param game object of which the gate belongs to
-	*/
-	OrGate(Game* game);
-	void Draw(std::shared_ptr<wxGraphicsContext> gc) override;
+	/// Height of the two input OR gate in pixels
+	static constexpr int Height = 50;
+
+	/// How far the input pins are inside the left edge, to meet the curve
+	static constexpr double InputInset = 7.1;
 
-	void calculate() override;
+	/// How far the output pin is left of the gate width
+	static constexpr double OutputInset = 35.8;
 
 	/**
-	* virtual function to get size of gate
-	* @return size of gate
-	*/
-	const wxSize GetSize() override { return mSize; }
+	 * OR of all the inputs, UNKNOWN if any input is unknown
+	 * @param inputs States of the inputs
+	 * @return The output state
+	 */
+	template <size_t N>
+	static constexpr PinState Evaluate(const std::array<PinState, N>& inputs)
+	{
+		PinState result = PinState::ZERO;
+		for (PinState input : inputs)
+		{
+			if (input == PinState::UNKNOWN)
+			{
+				return PinState::UNKNOWN;
+			}
+			if (input == PinState::ONE)
+			{
+				result = PinState::ONE;
+			}
+		}
+		return result;
+	}
 
+	static void Draw(std::shared_ptr<wxGraphicsContext> graphics, double x, double y, double w, double h);
 };
 
+/// Two input OR gate
+using OrGate = LogicGate<OrOp, 2>;
+
+/// Three input OR gate
+using OrGate3 = LogicGate<OrOp, 3>;
+
+/// Four input OR gate
+using OrGate4 = LogicGate<OrOp, 4>;
+
+/// Eight input OR gate
+using OrGate8 = LogicGate<OrOp, 8>;
+
 
 #endif //ORGATE_H
@@ -6,12 +6,11 @@
 #include "pch.h"
 #include "Pin.h"
 #include "Game.h"
+#include "Gate.h"
+#include "Net.h"
 
 #include <algorithm>
 
-/// Diameter to draw the pin in pixels
-const int PinSize = 10;
-
 /// Color to use for drawing a zero connection wire
 const wxColour ConnectionColorZero = *wxBLACK;
 
@@ -24,6 +23,9 @@ const wxColour ConnectionColorUnknown = wxColour(128, 128, 128);
 /// Maximum offset of Bezier control points relative to line ends
 static const int BezierMaxOffset = 200;
 
+/// Number of pins that have been constructed and not destroyed
+static size_t LivePins = 0;
+
 
 /**
  * Constructor
@@ -54,7 +56,39 @@ Pin::Pin(Game* game, PinType type, double x, double y, PinState state, int len)
     mType = type;
 
     mLineLength = len;
+    LivePins++;
     SetLocation(-1, -1); // When the location is not -1, -1 the mouse is dragging it
+
+    // Every output drives its own net
+    if (type == PinType::OUTPUT)
+    {
+        mNet = std::make_shared<Net>(this, state);
+    }
+}
+
+
+/**
+ * Destructor
+ *
+ * Takes the pin off its net, which may outlive it,
+ * and off the pins wired to it
+ */
+Pin::~Pin()
+{
+    LivePins--;
+    for (Pin* pin : mConnectedPins)
+    {
+        pin->RemoveConnectedPin(this);
+    }
+
+    if (mType == PinType::OUTPUT)
+    {
+        mNet->ClearDriver();
+    }
+    else
+    {
+        DetachNet();
+    }
 }
 
 
@@ -77,133 +111,26 @@ void Pin::Draw(std::shared_ptr<wxGraphicsContext> graphics)
     linePath.AddLineToPoint(pinX, pinY); // End at pin center
 
     // Set up line appearance
-    if (mState == PinState::UNKNOWN)
+    PinState state = GetState();
+    if (state == PinState::UNKNOWN)
     {
         graphics->SetPen(wxPen(ConnectionColorUnknown, LineWidth));
         graphics->SetBrush(wxBrush(ConnectionColorUnknown));
     }
 
-    else if (mState == PinState::ONE)
+    else if (state == PinState::ONE)
     {
         graphics->SetPen(wxPen(ConnectionColorOne, LineWidth));
         graphics->SetBrush(wxBrush(ConnectionColorOne));
     }
 
-    else if (mState == PinState::ZERO)
+    else if (state == PinState::ZERO)
     {
         graphics->SetPen(wxPen(ConnectionColorZero, LineWidth));
         graphics->SetBrush(wxBrush(ConnectionColorZero));
     }
     graphics->DrawPath(linePath);
 
-    if (mType == PinType::OUTPUT)
-    {
-        if (GetX() != -1 && GetY() != -1)
-        {
-            wxPoint p1(pinX, pinY); // Start point (output pin)
-            wxPoint p4(GetX(), GetY()); // End point (mouse position while dragging)
-
-            // Calculate offset for p2 and p3
-            int distance = std::min(BezierMaxOffset, std::abs(p4.x - p1.x));
-
-            // Set control points p2 and p3 based on distance
-            wxPoint p2(p1.x + distance, p1.y); // p2 to the right of p1
-            wxPoint p3(p4.x - distance, p4.y); // p3 to the left of p4
-
-            // Create the path for the Bézier curve
-            auto linePath = graphics->CreatePath();
-            linePath.MoveToPoint(p1);
-            linePath.AddCurveToPoint(p2, p3, p4);
-            graphics->StrokePath(linePath);
-
-            if (GetGame()->GetControlPoints())
-            {
-                // Draw control points as small circles
-                const double crossSize = 10.0;
-                const double pinTextOffset = 5.0;
-                graphics->SetBrush(*wxRED_BRUSH); // Use red color for control points
-                graphics->SetPen(*wxRED_PEN);
-                wxGraphicsFont font = graphics->CreateFont(12, L"Arial", wxFONTFLAG_BOLD, *wxBLACK);
-                graphics->SetFont(font);
-
-                graphics->StrokeLine(p1.x - crossSize, p1.y, p1.x + crossSize, p1.y);
-                graphics->StrokeLine(p1.x, p1.y - crossSize, p1.x, p1.y + crossSize);
-                graphics->DrawText("p1", p1.x+pinTextOffset, p1.y+pinTextOffset);
-
-                graphics->StrokeLine(p2.x - crossSize, p2.y, p2.x + crossSize, p2.y);
-                graphics->StrokeLine(p2.x, p2.y - crossSize, p2.x, p2.y + crossSize);
-                graphics->DrawText("p2", p2.x+pinTextOffset, p2.y+pinTextOffset);
-
-                graphics->StrokeLine(p3.x - crossSize, p3.y, p3.x + crossSize, p3.y);
-                graphics->StrokeLine(p3.x, p3.y - crossSize, p3.x, p3.y + crossSize);
-                graphics->DrawText("p3", p3.x+pinTextOffset, p3.y+pinTextOffset);
-
-                graphics->StrokeLine(p4.x - crossSize, p4.y, p4.x + crossSize, p4.y);
-                graphics->StrokeLine(p4.x, p4.y - crossSize, p4.x, p4.y + crossSize);
-                graphics->DrawText("p4", p4.x+pinTextOffset, p4.y+pinTextOffset);
-
-                graphics->SetPen(*wxGREEN_PEN);
-
-                // Rectangle drawing
-                graphics->StrokeLine(p1.x, p1.y, p2.x, p2.y);
-                graphics->StrokeLine(p1.x, p1.y, p3.x, p3.y);
-                graphics->StrokeLine(p3.x, p3.y, p4.x, p4.y);
-                graphics->StrokeLine(p4.x, p4.y, p2.x, p2.y);
-            }
-        }
-
-        for (auto pin : mConnectedPins)
-        {
-            wxPoint p1(pinX, pinY);
-            wxPoint p4(pin->GetAbsoluteX(), pin->GetAbsoluteY());
-
-            int distance = std::min(BezierMaxOffset, static_cast<int>(std::abs(p4.x - p1.x)));
-
-            wxPoint p2(p1.x + distance, p1.y);
-            wxPoint p3(p4.x - distance, p4.y);
-
-            auto linePath = graphics->CreatePath();
-            linePath.MoveToPoint(p1);
-            linePath.AddCurveToPoint(p2, p3, p4);
-            graphics->StrokePath(linePath);
-
-            if (GetGame()->GetControlPoints())
-            {
-                // Draw control points as small circles
-                const double crossSize = 10.0;
-                const double pinTextOffset = 5.0;
-                graphics->SetBrush(*wxRED_BRUSH); // Use red color for control points
-                graphics->SetPen(*wxRED_PEN);
-                wxGraphicsFont font = graphics->CreateFont(12, L"Arial", wxFONTFLAG_BOLD, *wxBLACK);
-                graphics->SetFont(font);
-
-                graphics->StrokeLine(p1.x - crossSize, p1.y, p1.x + crossSize, p1.y);
-                graphics->StrokeLine(p1.x, p1.y - crossSize, p1.x, p1.y + crossSize);
-                graphics->DrawText("p1", p1.x+pinTextOffset, p1.y+pinTextOffset);
-
-                graphics->StrokeLine(p2.x - crossSize, p2.y, p2.x + crossSize, p2.y);
-                graphics->StrokeLine(p2.x, p2.y - crossSize, p2.x, p2.y + crossSize);
-                graphics->DrawText("p2", p2.x+pinTextOffset, p2.y+pinTextOffset);
-
-                graphics->StrokeLine(p3.x - crossSize, p3.y, p3.x + crossSize, p3.y);
-                graphics->StrokeLine(p3.x, p3.y - crossSize, p3.x, p3.y + crossSize);
-                graphics->DrawText("p3", p3.x+pinTextOffset, p3.y+pinTextOffset);
-
-                graphics->StrokeLine(p4.x - crossSize, p4.y, p4.x + crossSize, p4.y);
-                graphics->StrokeLine(p4.x, p4.y - crossSize, p4.x, p4.y + crossSize);
-                graphics->DrawText("p4", p4.x+pinTextOffset, p4.y+pinTextOffset);
-
-                graphics->SetPen(*wxGREEN_PEN);
-
-                // Rectangle drawing
-                graphics->StrokeLine(p1.x, p1.y, p2.x, p2.y);
-                graphics->StrokeLine(p1.x, p1.y, p3.x, p3.y);
-                graphics->StrokeLine(p3.x, p3.y, p4.x, p4.y);
-                graphics->StrokeLine(p4.x, p4.y, p2.x, p2.y);
-            }
-        }
-    }
-
     // Draw the pin circle
     auto circlePath = graphics->CreatePath();
     circlePath.AddCircle(pinX, pinY, PinSize / 2);
@@ -216,22 +143,143 @@ void Pin::Draw(std::shared_ptr<wxGraphicsContext> graphics)
 }
 
 
+/**
+ * Draw the wires from an output pin, to each input it is
+ * connected to and to the mouse while it is being dragged
+ * @param graphics gc context to draw on
+ */
+void Pin::DrawWires(std::shared_ptr<wxGraphicsContext> graphics)
+{
+    if (mType != PinType::OUTPUT)
+    {
+        return;
+    }
+
+    wxPoint start(mGateX + mRelativeX, mGateY + mRelativeY);
+    if (GetX() != -1 && GetY() != -1)
+    {
+        // End at the mouse position while dragging
+        DrawWire(graphics, start, wxPoint(GetX(), GetY()));
+    }
+
+    for (Pin* pin : mConnectedPins)
+    {
+        DrawWire(graphics, start, wxPoint(pin->GetAbsoluteX(), pin->GetAbsoluteY()));
+    }
+}
+
+/**
+ * Draw one wire as a Bezier curve, and its control points
+ * if they are turned on
+ * @param graphics gc context to draw on
+ * @param p1 Start point at the output pin
+ * @param p4 End point
+ */
+void Pin::DrawWire(std::shared_ptr<wxGraphicsContext> graphics, wxPoint p1, wxPoint p4)
+{
+    // The wire has the color of the state it carries
+    PinState state = GetState();
+    if (state == PinState::UNKNOWN)
+    {
+        graphics->SetPen(wxPen(ConnectionColorUnknown, LineWidth));
+    }
+    else if (state == PinState::ONE)
+    {
+        graphics->SetPen(wxPen(ConnectionColorOne, LineWidth));
+    }
+    else
+    {
+        graphics->SetPen(wxPen(ConnectionColorZero, LineWidth));
+    }
+
+    // Calculate offset for p2 and p3
+    int distance = std::min(BezierMaxOffset, static_cast<int>(std::abs(p4.x - p1.x)));
+
+    // Set control points p2 and p3 based on distance
+    wxPoint p2(p1.x + distance, p1.y); // p2 to the right of p1
+    wxPoint p3(p4.x - distance, p4.y); // p3 to the left of p4
+
+    // Create the path for the Bézier curve
+    auto linePath = graphics->CreatePath();
+    linePath.MoveToPoint(p1);
+    linePath.AddCurveToPoint(p2, p3, p4);
+    graphics->StrokePath(linePath);
+
+    if (GetGame()->GetControlPoints())
+    {
+        // Draw control points as small circles
+        const double crossSize = 10.0;
+        const double pinTextOffset = 5.0;
+        graphics->SetBrush(*wxRED_BRUSH); // Use red color for control points
+        graphics->SetPen(*wxRED_PEN);
+        wxGraphicsFont font = graphics->CreateFont(12, L"Arial", wxFONTFLAG_BOLD, *wxBLACK);
+        graphics->SetFont(font);
+
+        graphics->StrokeLine(p1.x - crossSize, p1.y, p1.x + crossSize, p1.y);
+        graphics->StrokeLine(p1.x, p1.y - crossSize, p1.x, p1.y + crossSize);
+        graphics->DrawText("p1", p1.x+pinTextOffset, p1.y+pinTextOffset);
+
+        graphics->StrokeLine(p2.x - crossSize, p2.y, p2.x + crossSize, p2.y);
+        graphics->StrokeLine(p2.x, p2.y - crossSize, p2.x, p2.y + crossSize);
+        graphics->DrawText("p2", p2.x+pinTextOffset, p2.y+pinTextOffset);
+
+        graphics->StrokeLine(p3.x - crossSize, p3.y, p3.x + crossSize, p3.y);
+        graphics->StrokeLine(p3.x, p3.y - crossSize, p3.x, p3.y + crossSize);
+        graphics->DrawText("p3", p3.x+pinTextOffset, p3.y+pinTextOffset);
+
+        graphics->StrokeLine(p4.x - crossSize, p4.y, p4.x + crossSize, p4.y);
+        graphics->StrokeLine(p4.x, p4.y - crossSize, p4.x, p4.y + crossSize);
+        graphics->DrawText("p4", p4.x+pinTextOffset, p4.y+pinTextOffset);
+
+        graphics->SetPen(*wxGREEN_PEN);
+
+        // Rectangle drawing
+        graphics->StrokeLine(p1.x, p1.y, p2.x, p2.y);
+        graphics->StrokeLine(p1.x, p1.y, p3.x, p3.y);
+        graphics->StrokeLine(p3.x, p3.y, p4.x, p4.y);
+        graphics->StrokeLine(p4.x, p4.y, p2.x, p2.y);
+    }
+}
+
+
 /**
  * Function to set the Pin state
+ *
+ * An output pin writes the state to its net, which tells the
+ * gates reading it if the state changed. An input pin that is
+ * wired follows its net, so this only sets the state an unwired
+ * input has, and tells its gate if that changed.
  * @param state the state to be set of the pin
  */
 void Pin::SetState(PinState state)
 {
-    mState = state;
     if (mType == PinType::OUTPUT)
     {
-        for (auto pin : mConnectedPins)
-        {
-            pin->SetState(state);
-        }
+        mNet->SetState(state);
+        return;
+    }
+
+    if (mState == state)
+    {
+        return;
+    }
+
+    mState = state;
+    if (!mNet && mSourceGate)
+    {
+        mSourceGate->OnInputChanged();
     }
 }
 
+/**
+ * Function to get the state of the Pin
+ * @return The state of the net for an output or wired input, otherwise the pin's own state
+ */
+PinState Pin::GetState() const
+{
+    return mNet ? mNet->GetState() : mState;
+}
+
 /**
  * Virtual function to test if a pin is hit at a given relative point
  * @param x Relative X coordinate of the point
@@ -257,23 +305,46 @@ void Pin::Release()
     // Insures that the pin is an input that connection attempt is on
     if (pin && pin->GetType() == PinType::INPUT)
     {
-        pin->ClearConnectedPins();
-        mConnectedPins.push_back(pin);
-        auto self = shared_from_this();
-        pin->AddConnectedPin(shared_from_this());
+        ConnectTo(pin);
     }
 
     SetLocation(-1, -1);
 }
 
+/**
+ * Wire this output pin to an input pin, replacing
+ * any wire already connected to that input
+ * @param pin Input pin to connect to
+ */
+void Pin::ConnectTo(std::shared_ptr<Pin> pin)
+{
+    pin->ClearConnectedPins();
+    mConnectedPins.push_back(pin.get());
+    pin->AddConnectedPin(this);
+    GetGame()->GetNetlist()->Connect(this, pin.get());
+}
+
 /**
  * Clear any connected pins from this pin's list of connected pins
  */
 void Pin::ClearConnectedPins()
 {
-    for (auto pin : mConnectedPins)
+    if (mType == PinType::INPUT)
+    {
+        DetachNet();
+    }
+
+    for (Pin* pin : mConnectedPins)
     {
         pin->RemoveConnectedPin(this);
+        if (mType == PinType::INPUT)
+        {
+            GetGame()->GetNetlist()->Disconnect(pin, this);
+        }
+        else
+        {
+            GetGame()->GetNetlist()->Disconnect(this, pin);
+        }
     }
     mConnectedPins.clear();
 }
@@ -289,7 +360,7 @@ void Pin::RemoveConnectedPin(Pin* pin)
     auto idx = -1;
     for (size_t i = 0; i < mConnectedPins.size(); i++)
     {
-        if (mConnectedPins[i].get() == pin)
+        if (mConnectedPins[i] == pin)
         {
             idx = i;
             break;
@@ -300,6 +371,27 @@ void Pin::RemoveConnectedPin(Pin* pin)
         return;
     }
     mConnectedPins.erase(mConnectedPins.begin() + idx);
+
+    if (mType == PinType::INPUT)
+    {
+        DetachNet();
+    }
+}
+
+/**
+ * Stop an input pin reading its net.
+ *
+ * The pin keeps the last state of the net as its own
+ * state, so unwiring it is not a change for its gate.
+ */
+void Pin::DetachNet()
+{
+    if (mNet)
+    {
+        mState = mNet->GetState();
+        mNet->RemoveSink(this);
+        mNet = nullptr;
+    }
 }
 
 /**
@@ -335,23 +427,33 @@ void Pin::UpdateGatePosition(double x, double y)
 /**
  * Function to add Pin to the collection of
  * ConnectedPins for this Pin
+ *
+ * An input pin starts reading the net of the output
+ * pin, and its gate is told if that changes its state.
  * @param pin Pointer to Pin
  */
-void Pin::AddConnectedPin(std::shared_ptr<Pin> pin)
+void Pin::AddConnectedPin(Pin* pin)
 {
     mConnectedPins.push_back(pin);
-    this->SetState(pin->GetState());
+    if (mType == PinType::INPUT)
+    {
+        PinState old = GetState();
+        DetachNet();
+        mNet = pin->mNet;
+        mNet->AddSink(this);
+        if (GetState() != old && mSourceGate)
+        {
+            mSourceGate->OnInputChanged();
+        }
+    }
 }
 
-
 /**
- * Function to update all the connected Pins as per
- * state of this Pin
+ * Get the number of pins that exist, to check wired
+ * pins are freed when their items are
+ * @return Pins constructed and not yet destroyed
  */
-void Pin::Update()
+size_t Pin::GetLiveCount()
 {
-    for(auto pin : mConnectedPins)
-    {
-        pin->SetState(this->GetState());
-    }
+    return LivePins;
 }
@@ -14,6 +14,11 @@
 
 class Game;
 class Gate;
+class Net;
+
+/// Diameter to draw the pin in pixels, and how far from its
+/// center a click still hits it
+const int PinSize = 10;
 
 /// Enum class for PinType
 enum class PinType
@@ -31,7 +36,7 @@ enum class PinState
 /**
  * Class that represents the pin item
  */
-class Pin : public Item, public std::enable_shared_from_this<Pin>
+class Pin : public Item
 {
 private:
     // Gate boundary reference points
@@ -52,9 +57,12 @@ private:
     /// relative Y position
     double mRelativeY;
 
-    /// state of the pin
+    /// state of the pin while it is not reading a net
     PinState mState = PinState::ONE;
 
+    /// Net driven by an output pin, or read by a wired input pin
+    std::shared_ptr<Net> mNet;
+
     /// length of the line
     int mLineLength;
 
@@ -62,12 +70,17 @@ private:
     Gate* mSourceGate = nullptr;
 
     /// Gate X coordinate
-    double mGateX;
+    double mGateX = 0;
     /// Gate Y coordinate
-    double mGateY;
+    double mGateY = 0;
 
-    /// All Pins connected to this pin
-    std::vector<std::shared_ptr<Pin>> mConnectedPins;
+    /// All Pins connected to this pin. The pins are owned by their
+    /// items, not by the wire, and take themselves off the list of
+    /// the other end when they are destroyed.
+    std::vector<Pin*> mConnectedPins;
+
+    void DetachNet();
+    void DrawWire(std::shared_ptr<wxGraphicsContext> graphics, wxPoint p1, wxPoint p4);
 
 public:
     // deleting default constructors
@@ -84,17 +97,20 @@ public:
 
     // Constructor to use
     Pin(Game* game, PinType type, double boundaryX, double boundaryY, PinState state = PinState::UNKNOWN, int len = 20);
+    ~Pin() override;
 
     // Draw function
     void Draw(std::shared_ptr<wxGraphicsContext> graphics) override;
+    void DrawWires(std::shared_ptr<wxGraphicsContext> graphics) override;
 
     void SetState(PinState state);
+    PinState GetState() const;
 
     /**
-    * Function to get the state of the Pin
-    * @return the state of the Pin
-    */
-    PinState GetState() { return mState; }
+     * Getter for the net of this pin
+     * @return The net an output drives or a wired input reads, nullptr for an unwired input
+     */
+    Net* GetNet() const { return mNet.get(); }
 
     /**
      * Getter to get the Gate to which this Pin
@@ -110,6 +126,12 @@ public:
      */
     void setSourceGate(Gate* gate) { mSourceGate = gate; }
 
+    /**
+     * Getter for the pins this pin is wired to
+     * @return Input pins for an output pin, the driving output pin for an input pin
+     */
+    const std::vector<Pin*>& GetConnectedPins() const { return mConnectedPins; }
+
     /**
     * Getter for pin type
     * @return Type of the pin
@@ -118,13 +140,27 @@ public:
 
     bool HitTest(int x, int y) override;
     void Release() override;
+    void ConnectTo(std::shared_ptr<Pin> pin);
     void ClearConnectedPins();
     void RemoveConnectedPin(Pin* pin);
     double GetAbsoluteX();
     double GetAbsoluteY();
+
+    /**
+     * Getter for the position of the pin relative to its gate
+     * @return X offset from the center of the gate
+     */
+    double GetRelativeX() const { return mRelativeX; }
+
+    /**
+     * Getter for the position of the pin relative to its gate
+     * @return Y offset from the center of the gate
+     */
+    double GetRelativeY() const { return mRelativeY; }
     void UpdateGatePosition(double x, double y);
-    void AddConnectedPin(std::shared_ptr<Pin> pin);
-    void Update();
+    void AddConnectedPin(Pin* pin);
+
+    static size_t GetLiveCount();
 };
 
 
@@ -0,0 +1,76 @@
+/**
+ * @file PinSpan.h
+ * @author Ethan Springer, Daksh Mehta, Sehaj Gupta, Lukas Schaefer, Jack McNamara
+ *
+ * A non-owning view of some of the pins of a gate
+ */
+
+#ifndef PINSPAN_H
+#define PINSPAN_H
+
+#include <memory>
+#include <vector>
+
+class Pin;
+
+/**
+ * A non-owning view of some of the pins of a gate.
+ *
+ * Points straight into the pin vector of the gate, so getting
+ * the pins and looping over them allocates nothing and does not
+ * touch the reference counts. Only valid while the gate is alive
+ * and not adding pins, which gates only do in their constructor.
+ */
+class PinSpan
+{
+private:
+    /// First pin in the view
+    const std::shared_ptr<Pin>* mBegin = nullptr;
+
+    /// Number of pins in the view
+    size_t mSize = 0;
+
+public:
+    /// Constructor for an empty view
+    PinSpan() = default;
+
+    /**
+     * Constructor
+     * @param pins Pins to view, not copied
+     */
+    PinSpan(const std::vector<std::shared_ptr<Pin>>& pins) : mBegin(pins.data()), mSize(pins.size()) {}
+
+    /**
+     * Get a pin in the view
+     * @param i Index of the pin
+     * @return The pin
+     */
+    const std::shared_ptr<Pin>& operator[](size_t i) const { return mBegin[i]; }
+
+    /**
+     * Get the number of pins in the view
+     * @return Number of pins
+     */
+    size_t size() const { return mSize; }
+
+    /**
+     * Is the view empty
+     * @return True if there are no pins
+     */
+    bool empty() const { return mSize == 0; }
+
+    /**
+     * Get the start of the view for range based loops
+     * @return Pointer to the first pin
+     */
+    const std::shared_ptr<Pin>* begin() const { return mBegin; }
+
+    /**
+     * Get the end of the view for range based loops
+     * @return Pointer past the last pin
+     */
+    const std::shared_ptr<Pin>* end() const { return mBegin + mSize; }
+};
+
+
+#endif //PINSPAN_H
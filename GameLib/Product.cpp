@@ -7,12 +7,6 @@
 #include "Product.h"
 
 #include "Conveyor.h"
-#include "ConveyorVisitor.h"
-#include "ProductVisitor.h"
-#include "Sensor.h"
-#include "SensorVisitor.h"
-#include "Sparty.h"
-#include "SpartyVisitor.h"
 
 
 /// Color to use for "red"
@@ -62,14 +56,7 @@ void Product::XmlLoad(wxXmlNode* node)
     ChangeContent(content);
 
     auto kick = node->GetAttribute(L"kick");
-    if (kick == L"yes")
-    {
-        mKick = true;
-    }
-    else
-    {
-        mKick = false;
-    }
+    GetGame()->GetProductStore().SetShouldKick(mSlot, kick == L"yes");
     double y = 0;
     auto placement = node->GetAttribute(L"placement");
     placement.ToDouble(&y);
@@ -93,6 +80,8 @@ void Product::Draw(std::shared_ptr<wxGraphicsContext> gc)
 {
     /// Stores the offset in the up down direction
     double offsetY = GetYOffset();
+    /// Stores the offset in the left right direction
+    double offsetX = GetXOffset();
     gc->SetPen(*wxTRANSPARENT_PEN);
     if (mColor == Color::Red)
     {
@@ -113,20 +102,20 @@ void Product::Draw(std::shared_ptr<wxGraphicsContext> gc)
 
     if (mShape == Shape::Circle)
     {
-        gc->DrawEllipse(GetX() - ProductDefaultSize / 2 + mOffsetX, GetYOffset() + GetY() - ProductDefaultSize / 2,
+        gc->DrawEllipse(GetX() - ProductDefaultSize / 2 + offsetX, offsetY + GetY() - ProductDefaultSize / 2,
                         ProductDefaultSize,
                         ProductDefaultSize);
     }
     else if (mShape == Shape::Square)
     {
-        gc->DrawRectangle(GetX() - ProductDefaultSize / 2 + mOffsetX, GetYOffset() + GetY() - ProductDefaultSize / 2,
+        gc->DrawRectangle(GetX() - ProductDefaultSize / 2 + offsetX, offsetY + GetY() - ProductDefaultSize / 2,
                           ProductDefaultSize,
                           ProductDefaultSize);
     }
     else if (mShape == Shape::Diamond)
     {
         gc->PushState();
-        gc->Translate(GetX() + mOffsetX, offsetY + GetY() - SQRT2 * ProductDefaultSize / 2);
+        gc->Translate(GetX() + offsetX, offsetY + GetY() - SQRT2 * ProductDefaultSize / 2);
         gc->Rotate(PI / 4);
         gc->DrawRectangle(0, 0, ProductDefaultSize, ProductDefaultSize);
         gc->PopState();
@@ -135,7 +124,7 @@ void Product::Draw(std::shared_ptr<wxGraphicsContext> gc)
     {
         double width = ProductDefaultSize * ContentScale;
         double height = ProductDefaultSize * ContentScale;
-        gc->DrawBitmap(*mBitmap, GetX() - width / 2 + mOffsetX, GetYOffset() + GetY() - height / 2, width, height);
+        gc->DrawBitmap(*mBitmap, GetX() - width / 2 + offsetX, offsetY + GetY() - height / 2, width, height);
     }
 }
 
@@ -149,8 +138,15 @@ void Product::Draw(std::shared_ptr<wxGraphicsContext> gc)
  */
 void Product::Kick(double speed)
 {
-    mKickSpeed = speed;
-    GetGame()->GetScore()->UpdateLevelScore(mKick);
+    ProductStore& store = GetGame()->GetProductStore();
+    store.SetKickSpeed(mSlot, speed);
+    GetGame()->GetScore()->UpdateLevelScore(store.ShouldKick(mSlot));
+
+    Conveyor* conveyor = GetGame()->GetRegistry().GetConveyor();
+    if (conveyor != nullptr && IsKicked())
+    {
+        conveyor->OnKicked(this);
+    }
 }
 
 /**
@@ -200,60 +196,5 @@ void Product::ChangeContent(const wxString& content)
  */
 double Product::GetYOffset()
 {
-    return mOffsetY;
-}
-
-/**
- * @brief Updates the product's position based on elapsed time.
- *
- * This function determines the movement of the product depending on whether it
- * has been kicked or not. If the product has been kicked, it will move in the x
- * direction at the speed specified by mKickSpeed. Otherwise, it will update its
- * y offset to match the conveyor's offset.
- *
- * @param elapsed The time elapsed since the last update
- */
-void Product::Update(double elapsed)
-{
-    SensorVisitor visit;
-    GetGame()->Accept(&visit);
-    auto sensor = visit.GetSensor();
-    if(sensor != nullptr)
-    {
-        sensor->PropertyBoxState(this);
-    }
-
-    // If the product has been kicked, move it in the kick direction
-    if (mKickSpeed > 0)
-    {
-        mOffsetX -= mKickSpeed * elapsed;
-    }
-    // If the product has not been kicked the conveyor is the only source of movement
-    else
-    {
-        // Update the y offset
-        double oldYOffset = mOffsetY;
-        ConveyorVisitor visitor;
-        GetGame()->Accept(&visitor);
-        Conveyor* conveyor = visitor.GetConveyor();
-        if (conveyor != nullptr)
-        {
-            mOffsetY = conveyor->GetOffset();
-        }
-        // Checks if the product is past where sparty can kick
-        SpartyVisitor spartyVisitor;
-        GetGame()->Accept(&spartyVisitor);
-        Sparty* sparty = spartyVisitor.GetSparty();
-        if (sparty != nullptr)
-        {
-            /// Stores sparty's kick y relative to the products y offset
-            double spartyKickYOffset = sparty->GetKickY() - GetY() + ProductDefaultSize / 2;
-            // This means that this has just passed by sparty
-            if (mOffsetY > spartyKickYOffset && oldYOffset <= spartyKickYOffset)
-            {
-                GetGame()->GetScore()->UpdateLevelScore(!mKick);
-            }
-        }
-
-    }
+    return GetGame()->GetProductStore().GetOffsetY(mSlot);
 }
@@ -33,7 +33,7 @@ enum class Shape { Circle, Square, Diamond };
 enum class Content { Izzo, Smith, Football, Basketball, None };
 
 /// Class for a product
-class Product : public Item
+class Product final : public Item
 {
 private:
 
@@ -47,22 +47,14 @@ private:
     std::shared_ptr<wxImage> mImage = nullptr;
     /// Stores the bitmap for the content
     std::shared_ptr<wxBitmap> mBitmap = nullptr;
-    /// If this product should be kicked
-    bool mKick = false;
-
     void ChangeContent(const wxString& content);
 
     /// The y coordinate offset of the previous product
     double mPrevProdYCoord = 0;
 
-    /// The movement in the y direction
-    double mOffsetY = 0;
-
-    /// The movement in the x direction
-    double mOffsetX = 0;
-
-    /// The kick speed set when the product is kicked
-    double mKickSpeed = 0;
+    /// Slot of the product in the product store of the game,
+    /// which holds its offsets and kick
+    size_t mSlot;
 
 public:
     /**
@@ -74,11 +66,25 @@ public:
         : Item(game)
     {
         mPrevProdYCoord = y;
+        mSlot = game->GetProductStore().Add();
     }
 
     void XmlLoad(wxXmlNode* node) override;
     void Draw(std::shared_ptr<wxGraphicsContext> gc) override;
 
+    /**
+     * Products ride on the conveyor, below the machines
+     * @return The conveyor layer
+     */
+    Layer GetLayer() const override { return Layer::Conveyor; }
+
+    /**
+     * Products have no pins and ignore clicks, so they
+     * are kept out of the hit testing grid
+     * @return false
+     */
+    bool IsClickable() const override { return false; }
+
     /**
      * Accepts a visitor for the product.
      *
@@ -93,6 +99,18 @@ public:
 
     void Kick(double speed);
 
+    /**
+     * Has the product been kicked off the conveyor
+     * @return True if the product is moving with a kick
+     */
+    bool IsKicked() { return GetGame()->GetProductStore().GetKickSpeed(mSlot) > 0; }
+
+    /**
+     * Get the slot of the product in the product store of the game
+     * @return Index of the product in the store arrays
+     */
+    size_t GetSlot() const { return mSlot; }
+
     double GetYOffset();
 
     /**
@@ -101,19 +119,9 @@ public:
      */
     double GetXOffset()
     {
-        return mOffsetX;
+        return GetGame()->GetProductStore().GetOffsetX(mSlot);
     };
 
-    void Update(double elapsed) override;
-
-    /// Resets the position of the product
-    void ResetPosition()
-    {
-        mOffsetY = 0;
-        mOffsetX = 0;
-        mKickSpeed = 0;
-    }
-
     /**
      * Getter to get the color of this Product
      * @return color of this Product of type enum Color
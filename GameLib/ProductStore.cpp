@@ -0,0 +1,88 @@
+/**
+ * @file ProductStore.cpp
+ * @author Ethan Springer, Daksh Mehta, Sehaj Gupta, Lukas Schaefer, Jack McNamara
+ */
+
+#include "pch.h"
+#include "ProductStore.h"
+
+using namespace std;
+
+/**
+ * Add a slot for a new product, at rest on the belt
+ * @return The slot of the product
+ */
+size_t ProductStore::Add()
+{
+    mBaseY.push_back(0);
+    mOffsetX.push_back(0);
+    mOffsetY.push_back(0);
+    mKickSpeed.push_back(0);
+    mShouldKick.push_back(0);
+    mCrossed.push_back(0);
+    return mOffsetY.size() - 1;
+}
+
+/**
+ * Remove every slot
+ */
+void ProductStore::Clear()
+{
+    mBaseY.clear();
+    mOffsetX.clear();
+    mOffsetY.clear();
+    mKickSpeed.clear();
+    mShouldKick.clear();
+    mCrossed.clear();
+    mPassed.clear();
+}
+
+/**
+ * Put every product back where it was placed on the belt
+ */
+void ProductStore::Reset()
+{
+    fill(mOffsetX.begin(), mOffsetX.end(), 0.0);
+    fill(mOffsetY.begin(), mOffsetY.end(), 0.0);
+    fill(mKickSpeed.begin(), mKickSpeed.end(), 0.0);
+    mPassed.clear();
+}
+
+/**
+ * Move every product for one tick.
+ *
+ * A product on the belt takes the belt offset, and a kicked
+ * product moves left at its kick speed. Products still on the
+ * belt that moved past the kick line are listed in GetPassed.
+ * @param elapsed Time since the last update in seconds
+ * @param belt Offset of the conveyor belt
+ * @param kickLine Y location a product passes Sparty at
+ */
+void ProductStore::Update(double elapsed, double belt, double kickLine)
+{
+    size_t count = mOffsetY.size();
+    const double* baseY = mBaseY.data();
+    const double* kickSpeed = mKickSpeed.data();
+    double* offsetX = mOffsetX.data();
+    double* offsetY = mOffsetY.data();
+    char* crossed = mCrossed.data();
+
+    for (size_t i = 0; i < count; i++)
+    {
+        bool onBelt = kickSpeed[i] <= 0;
+        double oldY = offsetY[i];
+        double newY = onBelt ? belt : oldY;
+        offsetX[i] -= kickSpeed[i] * elapsed;
+        offsetY[i] = newY;
+        crossed[i] = onBelt & (baseY[i] + oldY <= kickLine) & (baseY[i] + newY > kickLine);
+    }
+
+    mPassed.clear();
+    for (size_t i = 0; i < count; i++)
+    {
+        if (crossed[i])
+        {
+            mPassed.push_back(i);
+        }
+    }
+}
@@ -0,0 +1,124 @@
+/**
+ * @file ProductStore.h
+ * @author Ethan Springer, Daksh Mehta, Sehaj Gupta, Lukas Schaefer, Jack McNamara
+ *
+ * The moving state of every product in a game, one array per field
+ */
+
+#ifndef PRODUCTSTORE_H
+#define PRODUCTSTORE_H
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * The moving state of every product in a game, one array per field.
+ *
+ * Each product owns a slot, and its location on the belt, its
+ * offsets and its kick are kept in the arrays at that index
+ * rather than in the product. Update moves every product in one
+ * loop with no branches or calls, which the compiler can
+ * vectorize, so a level with thousands of products costs little
+ * per tick. Slots are only given back by Clear.
+ */
+class ProductStore
+{
+private:
+    /// Y location each product was placed at on the belt
+    std::vector<double> mBaseY;
+
+    /// Movement of each product in the x direction
+    std::vector<double> mOffsetX;
+
+    /// Movement of each product in the y direction
+    std::vector<double> mOffsetY;
+
+    /// Speed each product was kicked at, 0 if still on the belt
+    std::vector<double> mKickSpeed;
+
+    /// Nonzero for each product that should be kicked
+    std::vector<char> mShouldKick;
+
+    /// Nonzero for each product that passed the kick line in the last Update
+    std::vector<char> mCrossed;
+
+    /// Slots of the products that passed the kick line in the last Update
+    std::vector<size_t> mPassed;
+
+public:
+    size_t Add();
+    void Clear();
+    void Reset();
+    void Update(double elapsed, double belt, double kickLine);
+
+    /**
+     * Get the number of slots
+     * @return Number of products added since the last Clear
+     */
+    size_t GetSize() const { return mOffsetY.size(); }
+
+    /**
+     * Get the y location a product was placed at on the belt
+     * @param slot Slot of the product
+     * @return Y location before any belt movement
+     */
+    double GetBaseY(size_t slot) const { return mBaseY[slot]; }
+
+    /**
+     * Set the y location a product was placed at on the belt
+     * @param slot Slot of the product
+     * @param y Y location before any belt movement
+     */
+    void SetBaseY(size_t slot, double y) { mBaseY[slot] = y; }
+
+    /**
+     * Get the movement of a product in the x direction
+     * @param slot Slot of the product
+     * @return X offset
+     */
+    double GetOffsetX(size_t slot) const { return mOffsetX[slot]; }
+
+    /**
+     * Get the movement of a product in the y direction
+     * @param slot Slot of the product
+     * @return Y offset
+     */
+    double GetOffsetY(size_t slot) const { return mOffsetY[slot]; }
+
+    /**
+     * Get the speed a product was kicked at
+     * @param slot Slot of the product
+     * @return Kick speed, 0 if the product is still on the belt
+     */
+    double GetKickSpeed(size_t slot) const { return mKickSpeed[slot]; }
+
+    /**
+     * Kick a product off the belt
+     * @param slot Slot of the product
+     * @param speed Speed of the kick
+     */
+    void SetKickSpeed(size_t slot, double speed) { mKickSpeed[slot] = speed; }
+
+    /**
+     * Should a product be kicked
+     * @param slot Slot of the product
+     * @return True if the product should be kicked
+     */
+    bool ShouldKick(size_t slot) const { return mShouldKick[slot] != 0; }
+
+    /**
+     * Set if a product should be kicked
+     * @param slot Slot of the product
+     * @param kick True if the product should be kicked
+     */
+    void SetShouldKick(size_t slot, bool kick) { mShouldKick[slot] = kick; }
+
+    /**
+     * Get the products that passed the kick line in the last Update
+     * @return Slots of the products
+     */
+    const std::vector<size_t>& GetPassed() const { return mPassed; }
+};
+
+
+#endif //PRODUCTSTORE_H
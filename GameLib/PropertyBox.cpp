@@ -5,6 +5,7 @@
 
 #include "pch.h"
 #include "PropertyBox.h"
+#include "Game.h"
 
 using namespace std;
 
@@ -25,7 +26,7 @@ const wstring basketballImage = L"images/basketball.png";
 PropertyBox::PropertyBox(Game* game, const wxColour& colour, std::wstring extrashape) : Item(game), mColour(colour),
                                                                                        mInside(extrashape)
 {
- mPin = make_shared<Pin>(game, PinType::OUTPUT, mSize.GetWidth(), mSize.GetHeight() * Half,
+ mPin = game->MakePin(PinType::OUTPUT, mSize.GetWidth(), mSize.GetHeight() * Half,
   PinState::ZERO);
 }
 
@@ -118,6 +119,15 @@ void PropertyBox::Draw(std::shared_ptr<wxGraphicsContext> gc)
  mPin->Draw(gc);
 }
 
+/**
+ * Function to draw the wires from the associated Pin
+ * @param gc graphics context to draw on
+ */
+void PropertyBox::DrawWires(std::shared_ptr<wxGraphicsContext> gc)
+{
+ mPin->DrawWires(gc);
+}
+
 
 /**
  * Function to update box and associated Pin
@@ -126,7 +136,6 @@ void PropertyBox::Draw(std::shared_ptr<wxGraphicsContext> gc)
 void PropertyBox::Update(double elapsed)
 {
  mPin->UpdateGatePosition(GetX(), GetY());
- mPin->Update();
 }
 
 
@@ -14,7 +14,7 @@
 /**
  * class for propery box
  */
-class PropertyBox : public Item
+class PropertyBox final : public Item
 {
 private:
  ///size of box
@@ -43,6 +43,7 @@ public:
   */
  PropertyBox(Game* game, const wxColour& colour , std::wstring extrashape = L"");
  void Draw(std::shared_ptr<wxGraphicsContext> gc) override;
+ void DrawWires(std::shared_ptr<wxGraphicsContext> gc) override;
  void Update(double elapsed) override;
  std::shared_ptr<Pin> PinHitTest(int x, int y) override;
 
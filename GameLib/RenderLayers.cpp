@@ -0,0 +1,113 @@
+/**
+ * @file RenderLayers.cpp
+ * @author Ethan Springer, Daksh Mehta, Sehaj Gupta, Lukas Schaefer, Jack McNamara
+ */
+
+#include "pch.h"
+#include "RenderLayers.h"
+
+/**
+ * Put an item on top of its layer
+ * @param item Item that is not in a layer
+ */
+void RenderLayers::Link(Item* item)
+{
+    Ends& ends = mLayers[int(item->GetLayer())];
+    item->mLayerBelow = ends.top;
+    item->mLayerAbove = nullptr;
+    if (ends.top != nullptr)
+    {
+        ends.top->mLayerAbove = item;
+    }
+    else
+    {
+        ends.bottom = item;
+    }
+    ends.top = item;
+}
+
+/**
+ * Take an item out of its layer
+ * @param item Item that is in a layer
+ */
+void RenderLayers::Unlink(Item* item)
+{
+    Ends& ends = mLayers[int(item->GetLayer())];
+    if (item->mLayerBelow != nullptr)
+    {
+        item->mLayerBelow->mLayerAbove = item->mLayerAbove;
+    }
+    else
+    {
+        ends.bottom = item->mLayerAbove;
+    }
+    if (item->mLayerAbove != nullptr)
+    {
+        item->mLayerAbove->mLayerBelow = item->mLayerBelow;
+    }
+    else
+    {
+        ends.top = item->mLayerBelow;
+    }
+    item->mLayerBelow = nullptr;
+    item->mLayerAbove = nullptr;
+}
+
+/**
+ * Add an item on top of its layer
+ * @param item Item to add, ignored if it is already in a layer
+ */
+void RenderLayers::Insert(Item* item)
+{
+    if (!item->mLayered)
+    {
+        Link(item);
+        item->mLayered = true;
+    }
+}
+
+/**
+ * Remove an item from its layer
+ * @param item Item to remove, ignored if it is not in a layer
+ */
+void RenderLayers::Remove(Item* item)
+{
+    if (item->mLayered)
+    {
+        Unlink(item);
+        item->mLayered = false;
+    }
+}
+
+/**
+ * Move an item to the top of its layer
+ * @param item Item to raise, ignored if it is not in a layer
+ */
+void RenderLayers::Raise(Item* item)
+{
+    if (item->mLayered && mLayers[int(item->GetLayer())].top != item)
+    {
+        Unlink(item);
+        Link(item);
+    }
+}
+
+/**
+ * Remove every item
+ */
+void RenderLayers::Clear()
+{
+    for (Ends& ends : mLayers)
+    {
+        Item* item = ends.bottom;
+        while (item != nullptr)
+        {
+            Item* above = item->mLayerAbove;
+            item->mLayerBelow = nullptr;
+            item->mLayerAbove = nullptr;
+            item->mLayered = false;
+            item = above;
+        }
+        ends = Ends();
+    }
+}
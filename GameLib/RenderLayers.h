@@ -0,0 +1,69 @@
+/**
+ * @file RenderLayers.h
+ * @author Ethan Springer, Daksh Mehta, Sehaj Gupta, Lukas Schaefer, Jack McNamara
+ *
+ * The drawing order of the items of a game, a list per layer
+ */
+
+#ifndef RENDERLAYERS_H
+#define RENDERLAYERS_H
+
+#include <array>
+#include "Item.h"
+
+/**
+ * The drawing order of the items of a game, a list per layer.
+ *
+ * Each layer is a doubly linked list threaded through the items
+ * themselves, bottom to top, so adding an item, removing it or
+ * raising it to the top of its layer changes a few pointers and
+ * never moves the other items. The lists do not own the items.
+ */
+class RenderLayers
+{
+private:
+    /// The ends of the list of one layer
+    struct Ends
+    {
+        /// Item drawn first
+        Item* bottom = nullptr;
+        /// Item drawn last
+        Item* top = nullptr;
+    };
+
+    /// The lists, indexed by Layer
+    std::array<Ends, LayerCount> mLayers;
+
+    void Link(Item* item);
+    void Unlink(Item* item);
+
+public:
+    void Insert(Item* item);
+    void Remove(Item* item);
+    void Raise(Item* item);
+    void Clear();
+
+    /**
+     * Call a function for each item in a layer, bottom to top
+     * @param layer Layer to go through
+     * @param visit Function called with each Item*
+     */
+    template <class Visit>
+    void ForEach(Layer layer, Visit visit) const
+    {
+        for (Item* item = mLayers[int(layer)].bottom; item != nullptr; item = item->mLayerAbove)
+        {
+            visit(item);
+        }
+    }
+
+    /**
+     * Get the item drawn last in a layer
+     * @param layer Layer to look in
+     * @return The top item, nullptr if the layer is empty
+     */
+    Item* GetTop(Layer layer) const { return mLayers[int(layer)].top; }
+};
+
+
+#endif //RENDERLAYERS_H
@@ -5,6 +5,7 @@
 
 #include "pch.h"
 #include "SRFlipFlop.h"
+#include "Game.h"
 
 using namespace std;
 
@@ -33,19 +34,19 @@ const int Eight = 8;
 
 SRFlipFlop::SRFlipFlop(Game* game) : Gate(game)
 {
-	auto inputPin1 = make_shared<Pin>(game, PinType::INPUT, -(mSize.GetWidth()) * Quarter + Eight,
+	auto inputPin1 = game->MakePin(PinType::INPUT, -(mSize.GetWidth()) * Quarter + Eight,
 									-(mSize.GetHeight() * Quarter) + ThirtyFive);
-	auto inputPin2 = make_shared<Pin>(game, PinType::INPUT, -mSize.GetWidth() * Quarter + Eight,
+	auto inputPin2 = game->MakePin(PinType::INPUT, -mSize.GetWidth() * Quarter + Eight,
 									mSize.GetHeight() * Quarter + Fourty);
-	auto outputPin1 = make_shared<Pin>(game, PinType::OUTPUT, mSize.GetWidth(),
+	auto outputPin1 = game->MakePin(PinType::OUTPUT, mSize.GetWidth(),
 										-mSize.GetHeight() * Quarter + ThirtyFive, PinState::ZERO);
-	auto outputPin2 = make_shared<Pin>(game, PinType::OUTPUT, mSize.GetWidth(),
+	auto outputPin2 = game->MakePin(PinType::OUTPUT, mSize.GetWidth(),
 										mSize.GetHeight() * Quarter + Fourty, PinState::ONE);
 
-	mPins.push_back(inputPin1);
-	mPins.push_back(inputPin2);
-	mPins.push_back(outputPin1);
-	mPins.push_back(outputPin2);
+	AddPin(inputPin1);
+	AddPin(inputPin2);
+	AddPin(outputPin1);
+	AddPin(outputPin2);
 }
 
 
@@ -88,41 +89,64 @@ void SRFlipFlop::Draw(std::shared_ptr<wxGraphicsContext> gc)
 
 /**
  * Decides the output state of the gate
+ *
+ * Samples the inputs and commits the result in one step
  */
 void SRFlipFlop::calculate()
 {
-	vector<shared_ptr<Pin>> InputPins = GetInputPins();
-	vector<shared_ptr<Pin>> OutputPins = GetOutputPins();
+	Sample();
+	Commit();
+}
+
+/**
+ * Work out the next state from S and R, holding
+ * the current outputs when neither is set
+ */
+void SRFlipFlop::Sample()
+{
+	PinSpan InputPins = GetInputPins();
+	PinSpan OutputPins = GetOutputPins();
 
-	if (InputPins.size() > 0 && InputPins[0] && InputPins[1]){
+	if (InputPins.size() > 1 && InputPins[0] && InputPins[1]){
 		PinState S = InputPins[1]->GetState();
 		PinState R = InputPins[0]->GetState();
 
-		shared_ptr<Pin> Output_Q = OutputPins[1];
-		shared_ptr<Pin> Output_Q_Bar = OutputPins[0];
+		mNextQState = OutputPins[1]->GetState();
+		mNextQBarState = OutputPins[0]->GetState();
 
 		// SR Flip-Flop truth table logic
 	    if (S == PinState::ONE && R == PinState::ONE)
 	    {
 	        // Invalid state (typically not allowed in SR flip-flops)
-	        SetOutput(Output_Q, PinState::UNKNOWN);
-	        SetOutput(Output_Q_Bar, PinState::UNKNOWN);
+	        mNextQState = PinState::UNKNOWN;
+	        mNextQBarState = PinState::UNKNOWN;
 	    }
 		else if (R == PinState::ONE)
 		{
 			// Reset the flip-flop
-			SetOutput(Output_Q, PinState::ZERO);
-			SetOutput(Output_Q_Bar, PinState::ONE);
+			mNextQState = PinState::ZERO;
+			mNextQBarState = PinState::ONE;
 		}
 		else if (S == PinState::ONE)
 		{
 			// Set the flip-flop
-			SetOutput(Output_Q, PinState::ONE);
-			SetOutput(Output_Q_Bar, PinState::ZERO);
+			mNextQState = PinState::ONE;
+			mNextQBarState = PinState::ZERO;
 		}
 	}
 }
 
+/**
+ * Drive Q and Q' from the last sample
+ */
+void SRFlipFlop::Commit()
+{
+	PinSpan OutputPins = GetOutputPins();
+
+	SetOutput(OutputPins[1], mNextQState);
+	SetOutput(OutputPins[0], mNextQBarState);
+}
+
 /**
  * Updates the SR Flip Flop gate, adjusting the absolute positions of its pins.
  *
@@ -27,6 +27,12 @@ private:
 	/// Vector of Pins
 	//std::vector<std::shared_ptr<Pin>> mPins;
 
+	/// State of Q to drive on the next commit
+	PinState mNextQState = PinState::ONE;
+
+	/// State of Q! to drive on the next commit
+	PinState mNextQBarState = PinState::ZERO;
+
 public:
 	SRFlipFlop() = delete;
 	SRFlipFlop(const SRFlipFlop&) = delete;
@@ -42,6 +48,27 @@ public:
 
 	void calculate() override;
 
+	/**
+	 * Get the logic function of this gate
+	 * @return GateOp::SRFlipFlop
+	 */
+	GateOp GetOp() const override { return GateOp::SRFlipFlop; }
+
+	/**
+	 * Get the propagation delay of this gate
+	 * @return 2 time units
+	 */
+	int GetDelay() const override { return 2; }
+
+	/**
+	 * The flip flop latches S and R once per tick
+	 * @return true
+	 */
+	bool IsSequential() const override { return true; }
+
+	void Sample() override;
+	void Commit() override;
+
 	/**
 	* Getter function for the size of the gate
 	* @return size of the gate
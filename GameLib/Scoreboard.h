@@ -58,6 +58,12 @@ public:
 	// function to draw scoreboard
 	void Draw(std::shared_ptr<wxGraphicsContext> graphics) override;
 
+	/**
+	 * The scoreboard is drawn over everything else
+	 * @return The overlay layer
+	 */
+	Layer GetLayer() const override { return Layer::Overlay; }
+
 	/**
 	 * getter for mGood
 	 * @return mGood value
@@ -60,7 +60,7 @@ void Sensor::XmlLoad(wxXmlNode* node)
         auto name = child->GetName();
         if (name == L"white")
         {
-            propBox = make_shared<PropertyBox>(GetGame(), *wxWHITE);
+            propBox = GetGame()->MakeLevelItem<PropertyBox>(*wxWHITE);
             propBox->SetX(startX);
             propBox->SetY(startY);
             //move the next box down by the height of the box 40 pixles
@@ -68,7 +68,7 @@ void Sensor::XmlLoad(wxXmlNode* node)
         }
         if (name == L"red")
         {
-            propBox = make_shared<PropertyBox>(GetGame(), OhioStateRed);
+            propBox = GetGame()->MakeLevelItem<PropertyBox>(OhioStateRed);
             propBox->SetX(startX);
             propBox->SetY(startY);
             //move the next box down by the height of the box 40 pixles
@@ -76,7 +76,7 @@ void Sensor::XmlLoad(wxXmlNode* node)
         }
         else if (name == L"green")
         {
-            propBox = make_shared<PropertyBox>(GetGame(), MSUGreen);
+            propBox = GetGame()->MakeLevelItem<PropertyBox>(MSUGreen);
             propBox->SetX(startX);
             propBox->SetY(startY);
             //move the next box down by the height of the box 40 pixles
@@ -84,7 +84,7 @@ void Sensor::XmlLoad(wxXmlNode* node)
         }
         else if (name == L"blue")
         {
-            propBox = make_shared<PropertyBox>(GetGame(), UofMBlue);
+            propBox = GetGame()->MakeLevelItem<PropertyBox>(UofMBlue);
             propBox->SetX(startX);
             propBox->SetY(startY);
             //move the next box down by the height of the box 40 pixles
@@ -92,7 +92,7 @@ void Sensor::XmlLoad(wxXmlNode* node)
         }
         else if (name == L"circle")
         {
-            propBox = make_shared<PropertyBox>(GetGame(), *wxLIGHT_GREY, L"Circle");
+            propBox = GetGame()->MakeLevelItem<PropertyBox>(*wxLIGHT_GREY, L"Circle");
             propBox->SetX(startX);
             propBox->SetY(startY);
             //move the next box down by the height of the box 40 pixles
@@ -100,7 +100,7 @@ void Sensor::XmlLoad(wxXmlNode* node)
         }
         else if (name == L"square")
         {
-            propBox = make_shared<PropertyBox>(GetGame(), *wxLIGHT_GREY, L"Square");
+            propBox = GetGame()->MakeLevelItem<PropertyBox>(*wxLIGHT_GREY, L"Square");
             propBox->SetX(startX);
             propBox->SetY(startY);
             //move the next box down by the height of the box 40 pixles
@@ -108,7 +108,7 @@ void Sensor::XmlLoad(wxXmlNode* node)
         }
         else if (name == L"izzo")
         {
-            propBox = make_shared<PropertyBox>(GetGame(), *wxLIGHT_GREY, L"Izzo");
+            propBox = GetGame()->MakeLevelItem<PropertyBox>(*wxLIGHT_GREY, L"Izzo");
             propBox->SetX(startX);
             propBox->SetY(startY);
             //move the next box down by the height of the box 40 pixles
@@ -116,7 +116,7 @@ void Sensor::XmlLoad(wxXmlNode* node)
         }
         else if (name == L"smith")
         {
-            propBox = make_shared<PropertyBox>(GetGame(), *wxLIGHT_GREY, L"Smith");
+            propBox = GetGame()->MakeLevelItem<PropertyBox>(*wxLIGHT_GREY, L"Smith");
             propBox->SetX(startX);
             propBox->SetY(startY);
             //move the next box down by the height of the box 40 pixles
@@ -124,7 +124,7 @@ void Sensor::XmlLoad(wxXmlNode* node)
         }
         else if (name == L"basketball")
         {
-            propBox = make_shared<PropertyBox>(GetGame(), *wxLIGHT_GREY, L"Basketball");
+            propBox = GetGame()->MakeLevelItem<PropertyBox>(*wxLIGHT_GREY, L"Basketball");
             propBox->SetX(startX);
             propBox->SetY(startY);
             //move the next box down by the height of the box 40 pixles
@@ -173,6 +173,29 @@ void Sensor::Draw(std::shared_ptr<wxGraphicsContext> graphics)
 }
 
 
+/**
+ * Update the Property Boxes from the products in front of the sensor
+ * @param elapsed Time since the last update in seconds
+ */
+void Sensor::Update(double elapsed)
+{
+	double range = SensorRange[1] - SensorRange[0] + ProductDefaultSize;
+	double y = GetY() - (SensorRange[0] + SensorRange[1]) / 2;
+	double x = GetX();
+
+	ProductVisitor visitor(y, x, range);
+	GetGame()->AcceptProducts(y, range, &visitor);
+	auto products = visitor.GetProducts();
+	if (products.empty())
+	{
+		Reset();
+	}
+	for (auto product : products)
+	{
+		PropertyBoxState(product);
+	}
+}
+
 /**
  * Function to change the state of the Pins
  * of the Property Boxes based on the
@@ -240,12 +263,6 @@ void Sensor::PropertyBoxState(Product* product)
 		}
 	}
 
-	ProductVisitor visitor(y, x, range);
-	GetGame()->Accept(&visitor);
-	if(visitor.GetProducts().empty())
-	{
-		Reset();
-	}
 }
 
 /**
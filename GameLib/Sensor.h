@@ -39,7 +39,7 @@ const wxColour PanelBackgroundColor = wxColour(128, 128, 128);
  * Inherited from Item
  * Can have variable number of supported outputs
  */
-class Sensor : public Item {
+class Sensor final : public Item {
 private:
  /// The image for the camera
  std::shared_ptr<wxImage> mCameraImage;
@@ -67,6 +67,7 @@ public:
   */
  void Accept(ItemVisitor* visitor) override {visitor->VisitSensor(this);};
 
+ void Update(double elapsed) override;
  void PropertyBoxState(Product* product);
  void Reset();
 };
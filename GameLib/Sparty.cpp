@@ -9,7 +9,6 @@
 #include <wx/display.h>
 
 #include "Conveyor.h"
-#include "ConveyorVisitor.h"
 #include "Game.h"
 #include "Product.h"
 #include "ProductVisitor.h"
@@ -127,37 +126,21 @@ void Sparty::Draw(std::shared_ptr<wxGraphicsContext> gc)
  */
 void Sparty::Update(double elapsed)
 {
-    ConveyorVisitor visitorConveyor;
-    GetGame()->Accept(&visitorConveyor);
-    bool conveyorRunning = false;
-    if (visitorConveyor.GetConveyor() != nullptr )
-    {
-        conveyorRunning = visitorConveyor.GetConveyor()->IsRunning();
-    }
-    // Check if the pin state went from ZERO to ONE and the conveyor is running to initiate kick
-    if (mPin->GetState() == PinState::ONE && mAnimationProgress >= mKickDuration && mPreviousPinState != PinState::ONE
-        && conveyorRunning)
-    {
-        Kick();
-    }
-    mPreviousPinState = mPin->GetState();
-
+    Conveyor* conveyor = GetGame()->GetRegistry().GetConveyor();
     double timeUntilNextKick = mKickDuration*SpartyKickPoint - mAnimationProgress;
     mAnimationProgress += elapsed;
     // Kick animation should now hit a product
     if (mAnimationProgress > mKickDuration*SpartyKickPoint && mAnimationProgress - elapsed < mKickDuration*SpartyKickPoint)
     {
-        ConveyorVisitor visitorConveyor;
-        GetGame()->Accept(&visitorConveyor);
         double y = GetKickY();
         double x = 0;
-        if (visitorConveyor.GetConveyor() != nullptr)
+        if (conveyor != nullptr)
         {
-            x = visitorConveyor.GetConveyor()->GetX();
-            y += visitorConveyor.GetConveyor()->GetSpeed() * timeUntilNextKick; // Correction due to lag for where the product should have been at the kick
+            x = conveyor->GetX();
+            y += conveyor->GetSpeed() * timeUntilNextKick; // Correction due to lag for where the product should have been at the kick
         }
         ProductVisitor visitor(y, x);
-        GetGame()->Accept(&visitor);
+        GetGame()->AcceptProducts(y, ProductDefaultSize, &visitor);
         auto products = visitor.GetProducts();
         for (auto product : products)
         {
@@ -167,6 +150,30 @@ void Sparty::Update(double elapsed)
     mPin->UpdateGatePosition(1130, 400);
 }
 
+/**
+ * Start a kick if the pin went from ZERO to ONE.
+ *
+ * Called every logic tick, so a pulse on the pin shorter
+ * than a frame still starts a kick. The animation itself
+ * runs in Update once per frame.
+ */
+void Sparty::CheckKick()
+{
+    Conveyor* conveyor = GetGame()->GetRegistry().GetConveyor();
+    bool conveyorRunning = false;
+    if (conveyor != nullptr)
+    {
+        conveyorRunning = conveyor->IsRunning();
+    }
+    // Check if the pin state went from ZERO to ONE and the conveyor is running to initiate kick
+    if (mPin->GetState() == PinState::ONE && mAnimationProgress >= mKickDuration && mPreviousPinState != PinState::ONE
+        && conveyorRunning)
+    {
+        Kick();
+    }
+    mPreviousPinState = mPin->GetState();
+}
+
 /**
  * Initiates the kick animation for Sparty.
  *
@@ -10,6 +10,7 @@
 #include "Item.h"
 #include "ItemVisitor.h"
 #include "Pin.h"
+#include "Game.h"
 class Game;
 
 /// Image for the sparty background, what is behind the boot
@@ -39,7 +40,7 @@ const double SpartyKickPoint = 0.35;
 const double SpartyBootPercentage = 0.80;
 
 /// Class for Sparty
-class Sparty : public Item
+class Sparty final : public Item
 {
 private:
     /// The duration of the kick
@@ -83,13 +84,26 @@ public:
         mBootBitmap = std::make_shared<wxBitmap>(*mBootImage);
         mFrontImage = std::make_shared<wxImage>(SpartyFrontImage);
         mFrontBitmap = std::make_shared<wxBitmap>(*mFrontImage);
-        mPin = std::make_shared<Pin>(game, PinType::INPUT ,0, 0);
+        mPin = game->MakePin(PinType::INPUT, 0, 0);
     }
 
     void XmlLoad(wxXmlNode* node) override;
     void Draw(std::shared_ptr<wxGraphicsContext> gc) override;
     void Update(double elapsed) override;
+    void CheckKick();
     void Kick();
+
+    /**
+     * Is Sparty in the middle of a kick
+     * @return True from the start of a kick until its animation ends
+     */
+    bool IsKicking() const { return mAnimationProgress < mKickDuration; }
+
+    /**
+     * Getter for Sparty's input pin
+     * @return The pin
+     */
+    std::shared_ptr<Pin> GetPin() { return mPin; }
     double GetKickY();
     std::shared_ptr<Pin> PinHitTest(int x, int y) override;
 
@@ -0,0 +1,198 @@
+/**
+ * @file SpatialGrid.cpp
+ * @author Ethan Springer, Daksh Mehta, Sehaj Gupta, Lukas Schaefer, Jack McNamara
+ */
+
+#include "pch.h"
+#include "SpatialGrid.h"
+#include "Item.h"
+#include <algorithm>
+#include <cmath>
+
+using namespace std;
+
+/**
+ * Combine the column and row of a cell into one key
+ * @param column Column of the cell
+ * @param row Row of the cell
+ * @return Key into mCells
+ */
+int64_t SpatialGrid::Key(int64_t column, int64_t row)
+{
+    return (column << 32) ^ (row & 0xffffffff);
+}
+
+/**
+ * Call visit with the key of every cell a box overlaps
+ * @param bounds The box
+ * @param visit Function taking the key of a cell
+ */
+template <class Visit>
+void SpatialGrid::ForEachCell(const Bounds& bounds, Visit visit)
+{
+    int64_t left = int64_t(floor(bounds.left / CellSize));
+    int64_t right = int64_t(floor(bounds.right / CellSize));
+    int64_t top = int64_t(floor(bounds.top / CellSize));
+    int64_t bottom = int64_t(floor(bounds.bottom / CellSize));
+    for (int64_t column = left; column <= right; column++)
+    {
+        for (int64_t row = top; row <= bottom; row++)
+        {
+            visit(Key(column, row));
+        }
+    }
+}
+
+/**
+ * Add an item to the cells or the everywhere list
+ * @param item The item
+ * @param record Where to list it
+ */
+void SpatialGrid::List(Item* item, const Record& record)
+{
+    Entry entry{item, record.order};
+    if (record.everywhere)
+    {
+        mEverywhere.push_back(entry);
+        return;
+    }
+    ForEachCell(record.bounds, [this, entry](int64_t key) { mCells[key].push_back(entry); });
+}
+
+/**
+ * Take an item out of the cells or the everywhere list
+ * @param item The item
+ * @param record Where it is listed
+ */
+void SpatialGrid::Unlist(Item* item, const Record& record)
+{
+    auto isItem = [item](const Entry& entry) { return entry.item == item; };
+    if (record.everywhere)
+    {
+        mEverywhere.erase(remove_if(mEverywhere.begin(), mEverywhere.end(), isItem), mEverywhere.end());
+        return;
+    }
+    ForEachCell(record.bounds, [this, &isItem](int64_t key)
+    {
+        auto cell = mCells.find(key);
+        if (cell != mCells.end())
+        {
+            auto& entries = cell->second;
+            entries.erase(remove_if(entries.begin(), entries.end(), isItem), entries.end());
+            if (entries.empty())
+            {
+                mCells.erase(cell);
+            }
+        }
+    });
+}
+
+/**
+ * Get the order of an item added or raised now, above every
+ * item of its layer and below every item of the layers above
+ * @param item The item
+ * @return The order, with the layer in the top byte
+ */
+uint64_t SpatialGrid::NextOrder(Item* item)
+{
+    return (uint64_t(item->GetLayer()) << 56) | mNextOrder++;
+}
+
+/**
+ * Add an item with bounds, on top of the items already added
+ * @param item The item
+ * @param bounds Box around everything of the item a click can hit
+ */
+void SpatialGrid::Insert(const shared_ptr<Item>& item, const Bounds& bounds)
+{
+    Record record{item, bounds, NextOrder(item.get()), false};
+    List(item.get(), record);
+    mRecords[item.get()] = record;
+}
+
+/**
+ * Add an item that is tested wherever the click is
+ * @param item The item
+ */
+void SpatialGrid::InsertEverywhere(const shared_ptr<Item>& item)
+{
+    Record record{item, Bounds{0, 0, 0, 0}, NextOrder(item.get()), true};
+    List(item.get(), record);
+    mRecords[item.get()] = record;
+}
+
+/**
+ * Update the bounds of an item after it moved
+ * @param item The item, ignored if it is not in the grid
+ * @param bounds Its new bounds
+ */
+void SpatialGrid::Move(Item* item, const Bounds& bounds)
+{
+    auto found = mRecords.find(item);
+    if (found == mRecords.end() || found->second.everywhere)
+    {
+        return;
+    }
+
+    Record& record = found->second;
+    Unlist(item, record);
+    record.bounds = bounds;
+    List(item, record);
+}
+
+/**
+ * Put an item on top of all the others in its layer
+ * @param item The item, ignored if it is not in the grid
+ */
+void SpatialGrid::Raise(Item* item)
+{
+    auto found = mRecords.find(item);
+    if (found == mRecords.end())
+    {
+        return;
+    }
+
+    Record& record = found->second;
+    Unlist(item, record);
+    record.order = NextOrder(item);
+    List(item, record);
+}
+
+/**
+ * Remove every item
+ */
+void SpatialGrid::Clear()
+{
+    mCells.clear();
+    mEverywhere.clear();
+    mRecords.clear();
+}
+
+/**
+ * Find the items that may be hit by a click
+ * @param x X location in virtual pixels
+ * @param y Y location in virtual pixels
+ * @param found Filled with the items listed in the cell of the
+ * point and those listed everywhere, topmost first
+ */
+void SpatialGrid::Query(double x, double y, vector<Entry>& found) const
+{
+    found.assign(mEverywhere.begin(), mEverywhere.end());
+    auto cell = mCells.find(Key(int64_t(floor(x / CellSize)), int64_t(floor(y / CellSize))));
+    if (cell != mCells.end())
+    {
+        found.insert(found.end(), cell->second.begin(), cell->second.end());
+    }
+    sort(found.begin(), found.end(), [](const Entry& a, const Entry& b) { return a.order > b.order; });
+}
+
+/**
+ * Get the shared pointer to an item in the grid
+ * @param item The item
+ * @return Pointer sharing ownership of the item, nullptr if not in the grid
+ */
+shared_ptr<Item> SpatialGrid::Find(Item* item) const
+{
+    auto found = mRecords.find(item);
+    return found != mRecords.end() ? found->second.item : nullptr;
+}
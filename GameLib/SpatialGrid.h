@@ -0,0 +1,111 @@
+/**
+ * @file SpatialGrid.h
+ * @author Ethan Springer, Daksh Mehta, Sehaj Gupta, Lukas Schaefer, Jack McNamara
+ *
+ * A uniform grid of the items in a game, for finding what a click hits
+ */
+
+#ifndef SPATIALGRID_H
+#define SPATIALGRID_H
+
+#include <cstdint>
+#include <memory>
+#include <unordered_map>
+#include <vector>
+
+class Item;
+
+/**
+ * A uniform grid of the items in a game, for finding what a click hits.
+ *
+ * An item with bounds is listed in every cell its bounds overlap
+ * and is moved between cells when it moves. An item without
+ * bounds, such as the conveyor, is listed as being everywhere.
+ * A query returns the items listed in the cell of the point and
+ * those everywhere, topmost first, so only a few of them need to
+ * be hit tested however many items there are.
+ *
+ * Each item has an order, the same as the order it is drawn in.
+ * An item on a higher layer is above every item on a lower one,
+ * and in a layer an item added or raised later is above the
+ * items before it.
+ */
+class SpatialGrid
+{
+public:
+    /// Width and height of a cell in virtual pixels
+    static constexpr double CellSize = 128;
+
+    /// An axis aligned box in virtual pixels
+    struct Bounds
+    {
+        /// Smallest x
+        double left;
+        /// Smallest y
+        double top;
+        /// Largest x
+        double right;
+        /// Largest y
+        double bottom;
+    };
+
+    /// An item listed in a cell
+    struct Entry
+    {
+        /// The item
+        Item* item;
+        /// Its order, higher is on top
+        uint64_t order;
+    };
+
+private:
+    /// Where an item is listed
+    struct Record
+    {
+        /// The item, kept so a query can hand it back
+        std::shared_ptr<Item> item;
+        /// The bounds it was listed with
+        Bounds bounds;
+        /// Its order, higher is on top
+        uint64_t order;
+        /// True if listed everywhere rather than by its bounds
+        bool everywhere;
+    };
+
+    /// Items listed in each cell, keyed by Key
+    std::unordered_map<int64_t, std::vector<Entry>> mCells;
+
+    /// Items listed everywhere
+    std::vector<Entry> mEverywhere;
+
+    /// Where each item is listed
+    std::unordered_map<Item*, Record> mRecords;
+
+    /// Order of the next item added or raised
+    uint64_t mNextOrder = 0;
+
+    static int64_t Key(int64_t column, int64_t row);
+    uint64_t NextOrder(Item* item);
+    template <class Visit>
+    void ForEachCell(const Bounds& bounds, Visit visit);
+    void List(Item* item, const Record& record);
+    void Unlist(Item* item, const Record& record);
+
+public:
+    void Insert(const std::shared_ptr<Item>& item, const Bounds& bounds);
+    void InsertEverywhere(const std::shared_ptr<Item>& item);
+    void Move(Item* item, const Bounds& bounds);
+    void Raise(Item* item);
+    void Clear();
+    void Query(double x, double y, std::vector<Entry>& found) const;
+    std::shared_ptr<Item> Find(Item* item) const;
+
+    /**
+     * Get the number of items in the grid
+     * @return Items listed by bounds or everywhere
+     */
+    size_t GetCount() const { return mRecords.size(); }
+};
+
+
+#endif //SPATIALGRID_H
@@ -0,0 +1,165 @@
+/**
+ * @file ThreadPool.cpp
+ * @author Ethan Springer, Daksh Mehta, Sehaj Gupta, Lukas Schaefer, Jack McNamara
+ */
+
+#include "pch.h"
+#include "ThreadPool.h"
+
+using namespace std;
+
+/**
+ * Constructor
+ * @param threads Number of threads to run loops on, including the calling thread
+ */
+ThreadPool::ThreadPool(unsigned threads)
+{
+    size_t workers = threads > 1 ? threads - 1 : 0;
+    for (size_t i = 0; i <= workers; i++)
+    {
+        mQueues.push_back(make_unique<Queue>());
+    }
+    for (size_t i = 0; i < workers; i++)
+    {
+        mThreads.emplace_back(&ThreadPool::WorkerLoop, this, i);
+    }
+}
+
+/**
+ * Destructor
+ *
+ * Stops and joins the worker threads
+ */
+ThreadPool::~ThreadPool()
+{
+    {
+        lock_guard<mutex> lock(mMutex);
+        mStop = true;
+    }
+    mWake.notify_all();
+    for (auto& thread : mThreads)
+    {
+        thread.join();
+    }
+}
+
+/**
+ * Run body over the indices 0 to count - 1 on all the threads.
+ *
+ * Each call of body gets a range of at most grain indices,
+ * and no index is in more than one range. Returns when every
+ * range has been run.
+ * @param count Number of indices
+ * @param grain Largest number of indices in one range
+ * @param body Function to run for each range
+ */
+void ThreadPool::ParallelFor(size_t count, size_t grain, const Body& body)
+{
+    if (count == 0)
+    {
+        return;
+    }
+    grain = max<size_t>(grain, 1);
+
+    size_t ranges = (count + grain - 1) / grain;
+    mBody = &body;
+    mRemaining = ranges;
+
+    // Deal the ranges out so each thread starts with a contiguous share
+    size_t perQueue = (ranges + mQueues.size() - 1) / mQueues.size();
+    for (size_t r = 0; r < ranges; r++)
+    {
+        size_t begin = r * grain;
+        Queue& queue = *mQueues[r / perQueue];
+        lock_guard<mutex> lock(queue.mutex);
+        queue.ranges.emplace_back(begin, min(begin + grain, count));
+    }
+
+    {
+        lock_guard<mutex> lock(mMutex);
+        mGeneration++;
+    }
+    mWake.notify_all();
+
+    // The calling thread uses the last queue
+    while (RunOne(mQueues.size() - 1))
+    {
+    }
+
+    unique_lock<mutex> lock(mMutex);
+    mDone.wait(lock, [this] { return mRemaining == 0; });
+    mBody = nullptr;
+}
+
+/**
+ * Run one range, from the thread's own queue if it has
+ * one and otherwise stolen from another thread
+ * @param index Queue of the thread
+ * @return False if there was no range left to run
+ */
+bool ThreadPool::RunOne(size_t index)
+{
+    pair<size_t, size_t> range;
+    bool found = false;
+
+    {
+        Queue& own = *mQueues[index];
+        lock_guard<mutex> lock(own.mutex);
+        if (!own.ranges.empty())
+        {
+            range = own.ranges.back();
+            own.ranges.pop_back();
+            found = true;
+        }
+    }
+
+    for (size_t i = 1; !found && i < mQueues.size(); i++)
+    {
+        Queue& victim = *mQueues[(index + i) % mQueues.size()];
+        lock_guard<mutex> lock(victim.mutex);
+        if (!victim.ranges.empty())
+        {
+            range = victim.ranges.front();
+            victim.ranges.pop_front();
+            found = true;
+        }
+    }
+
+    if (!found)
+    {
+        return false;
+    }
+
+    (*mBody)(range.first, range.second);
+    if (--mRemaining == 0)
+    {
+        lock_guard<mutex> lock(mMutex);
+        mDone.notify_all();
+    }
+    return true;
+}
+
+/**
+ * The loop each worker thread runs until the pool is destroyed
+ * @param index Queue of the worker
+ */
+void ThreadPool::WorkerLoop(size_t index)
+{
+    size_t seen = 0;
+    while (true)
+    {
+        {
+            unique_lock<mutex> lock(mMutex);
+            mWake.wait(lock, [this, seen] { return mStop || mGeneration != seen; });
+            if (mStop)
+            {
+                return;
+            }
+            seen = mGeneration;
+        }
+
+        while (RunOne(index))
+        {
+        }
+    }
+}
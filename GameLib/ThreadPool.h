@@ -0,0 +1,96 @@
+/**
+ * @file ThreadPool.h
+ * @author Ethan Springer, Daksh Mehta, Sehaj Gupta, Lukas Schaefer, Jack McNamara
+ *
+ * A pool of worker threads that split loops between them
+ */
+
+#ifndef THREADPOOL_H
+#define THREADPOOL_H
+
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+/**
+ * A pool of worker threads that split loops between them.
+ *
+ * ParallelFor cuts a loop into ranges and deals them out to one
+ * queue per thread. Each thread works from the back of its own
+ * queue and, when that is empty, steals from the front of the
+ * others, so threads that finish early help with the rest. The
+ * calling thread takes part too, and ParallelFor returns when
+ * every range is done.
+ */
+class ThreadPool
+{
+public:
+    /// The loop body, called with a range of indices [begin, end)
+    typedef std::function<void(size_t begin, size_t end)> Body;
+
+private:
+    /// Ranges waiting to run for one thread
+    struct Queue
+    {
+        /// Protects ranges
+        std::mutex mutex;
+        /// Ranges of indices, each a [begin, end) pair
+        std::deque<std::pair<size_t, size_t>> ranges;
+    };
+
+    /// The worker threads
+    std::vector<std::thread> mThreads;
+
+    /// One queue per worker thread, then one for the calling thread
+    std::vector<std::unique_ptr<Queue>> mQueues;
+
+    /// Protects mGeneration and mStop
+    std::mutex mMutex;
+
+    /// Wakes the workers when there is a new loop or they should stop
+    std::condition_variable mWake;
+
+    /// Wakes the calling thread when the last range is done
+    std::condition_variable mDone;
+
+    /// Counts the loops started, so workers can tell a new one has begun
+    size_t mGeneration = 0;
+
+    /// True when the workers should exit
+    bool mStop = false;
+
+    /// Body of the loop being run
+    const Body* mBody = nullptr;
+
+    /// Ranges of the current loop not finished yet
+    std::atomic<size_t> mRemaining{0};
+
+    void WorkerLoop(size_t index);
+    bool RunOne(size_t index);
+
+public:
+    explicit ThreadPool(unsigned threads);
+    ~ThreadPool();
+
+    /// Copy constructor (disabled)
+    ThreadPool(const ThreadPool&) = delete;
+
+    /// Assignment operator (disabled)
+    void operator=(const ThreadPool&) = delete;
+
+    void ParallelFor(size_t count, size_t grain, const Body& body);
+
+    /**
+     * Get the number of threads that run a loop
+     * @return Worker threads plus the calling thread
+     */
+    unsigned GetThreadCount() const { return unsigned(mThreads.size() + 1); }
+};
+
+
+#endif //THREADPOOL_H
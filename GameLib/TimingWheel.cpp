@@ -0,0 +1,80 @@
+/**
+ * @file TimingWheel.cpp
+ * @author Ethan Springer, Daksh Mehta, Sehaj Gupta, Lukas Schaefer, Jack McNamara
+ */
+
+#include "pch.h"
+#include "TimingWheel.h"
+#include <algorithm>
+
+using namespace std;
+
+/**
+ * Schedule a change to an output pin
+ * @param delay Time units from now, clamped to 1 to Slots - 1
+ * @param pin Output pin to change
+ * @param state State to set it to
+ */
+void TimingWheel::Schedule(int delay, Pin* pin, PinState state)
+{
+    delay = clamp(delay, 1, Slots - 1);
+    mSlots[(mTime + delay) % Slots].push_back({pin, state});
+    mPending++;
+}
+
+/**
+ * Move to the next time unit and take the changes due then
+ * @param due Filled with the changes, in the order they were scheduled
+ */
+void TimingWheel::Advance(vector<Event>& due)
+{
+    mTime++;
+    auto& slot = mSlots[mTime % Slots];
+    due.clear();
+    due.swap(slot);
+    mPending -= due.size();
+}
+
+/**
+ * Take every waiting change, earliest first, and empty the wheel
+ * @param due Filled with the changes
+ */
+void TimingWheel::Flush(vector<Event>& due)
+{
+    due.clear();
+    for (int i = 1; i < Slots && mPending > 0; i++)
+    {
+        auto& slot = mSlots[(mTime + i) % Slots];
+        due.insert(due.end(), slot.begin(), slot.end());
+        mPending -= slot.size();
+        slot.clear();
+    }
+}
+
+/**
+ * Drop the waiting changes to the outputs of a gate
+ * @param gate Gate being removed
+ */
+void TimingWheel::Cancel(const Gate* gate)
+{
+    for (auto& slot : mSlots)
+    {
+        size_t before = slot.size();
+        slot.erase(remove_if(slot.begin(), slot.end(),
+                             [gate](const Event& event) { return event.pin->getSourceGate() == gate; }),
+                   slot.end());
+        mPending -= before - slot.size();
+    }
+}
+
+/**
+ * Drop every waiting change
+ */
+void TimingWheel::Clear()
+{
+    for (auto& slot : mSlots)
+    {
+        slot.clear();
+    }
+    mPending = 0;
+}
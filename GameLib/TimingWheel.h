@@ -0,0 +1,79 @@
+/**
+ * @file TimingWheel.h
+ * @author Ethan Springer, Daksh Mehta, Sehaj Gupta, Lukas Schaefer, Jack McNamara
+ *
+ * Output changes waiting for the propagation delay of their gate
+ */
+
+#ifndef TIMINGWHEEL_H
+#define TIMINGWHEEL_H
+
+#include <cstdint>
+#include <vector>
+#include "Pin.h"
+
+class Gate;
+
+/**
+ * Output changes waiting for the propagation delay of their gate.
+ *
+ * The wheel has one slot per time unit, and a change due delay
+ * units from now goes in the slot that many places ahead of the
+ * current one. Advancing moves to the next slot and hands back
+ * what was in it, so scheduling and advancing cost the same no
+ * matter how many changes are waiting. Delays must be shorter
+ * than the number of slots.
+ */
+class TimingWheel
+{
+public:
+    /// Number of time units the wheel covers
+    static const int Slots = 64;
+
+    /// A change to an output pin
+    struct Event
+    {
+        /// Output pin to change
+        Pin* pin;
+        /// State to set it to
+        PinState state;
+    };
+
+private:
+    /// Changes waiting, indexed by due time modulo Slots
+    std::vector<std::vector<Event>> mSlots = std::vector<std::vector<Event>>(Slots);
+
+    /// The current time
+    uint64_t mTime = 0;
+
+    /// Number of changes waiting in all the slots
+    size_t mPending = 0;
+
+public:
+    void Schedule(int delay, Pin* pin, PinState state);
+    void Advance(std::vector<Event>& due);
+    void Flush(std::vector<Event>& due);
+    void Cancel(const Gate* gate);
+    void Clear();
+
+    /**
+     * Is there no change waiting
+     * @return True if every slot is empty
+     */
+    bool IsEmpty() const { return mPending == 0; }
+
+    /**
+     * Get the number of changes waiting
+     * @return Changes in all the slots
+     */
+    size_t GetPending() const { return mPending; }
+
+    /**
+     * Get the current time
+     * @return Time units advanced since the wheel was created
+     */
+    uint64_t GetTime() const { return mTime; }
+};
+
+
+#endif //TIMINGWHEEL_H
@@ -0,0 +1,169 @@
+/**
+ * @file TruthTable.cpp
+ * @author Ethan Springer, Daksh Mehta, Sehaj Gupta, Lukas Schaefer, Jack McNamara
+ */
+
+#include "pch.h"
+#include "TruthTable.h"
+#include "BitParallelCircuit.h"
+#include "CompiledCircuit.h"
+#include "Net.h"
+#include <algorithm>
+#include <unordered_map>
+#include <unordered_set>
+
+using namespace std;
+
+/**
+ * Identify the signal an input pin reads
+ * @param pin Input pin
+ * @return The net it is wired to, or the pin itself if unwired
+ */
+static const void* InputKey(const Pin* pin)
+{
+    return pin->GetNet() ? static_cast<const void*>(pin->GetNet()) : static_cast<const void*>(pin);
+}
+
+/**
+ * Find the inputs of a cluster.
+ *
+ * An input is a net driven from outside the cluster or an
+ * unwired input pin. Each gets one pin that reads it.
+ * @param gates Gates of the cluster
+ * @param inputs Filled with one pin per input
+ */
+void TruthTable::FindInputs(const vector<Gate*>& gates, vector<Pin*>& inputs)
+{
+    unordered_set<const Gate*> members(gates.begin(), gates.end());
+    unordered_set<const void*> seen;
+    for (Gate* gate : gates)
+    {
+        for (const auto& pin : gate->GetInputPins())
+        {
+            Net* net = pin->GetNet();
+            Pin* driver = net ? net->GetDriver() : nullptr;
+            if (driver && members.count(driver->getSourceGate()))
+            {
+                continue;
+            }
+
+            if (seen.insert(InputKey(pin.get())).second)
+            {
+                inputs.push_back(pin.get());
+            }
+        }
+    }
+}
+
+/**
+ * Count the inputs of a cluster
+ * @param gates Gates of the cluster
+ * @return Number of nets driven from outside plus unwired input pins
+ */
+size_t TruthTable::CountInputs(const vector<Gate*>& gates)
+{
+    vector<Pin*> inputs;
+    FindInputs(gates, inputs);
+    return inputs.size();
+}
+
+/**
+ * Constructor
+ *
+ * Builds the table by running the cluster compiled for every
+ * combination of its inputs.
+ * @param gates Gates of the cluster, every gate after the
+ * gates driving it, with at most MaxInputs inputs
+ */
+TruthTable::TruthTable(const vector<Gate*>& gates) : mGates(gates)
+{
+    FindInputs(gates, mInputs);
+
+    unordered_map<const void*, uint32_t> inputIndex;
+    for (size_t i = 0; i < mInputs.size(); i++)
+    {
+        inputIndex[InputKey(mInputs[i])] = i;
+    }
+
+    // Each output depends on the inputs of its gate and everything driving them
+    unordered_map<const Pin*, uint32_t> pinSupport;
+    for (Gate* gate : gates)
+    {
+        uint32_t support = 0;
+        for (const auto& pin : gate->GetInputPins())
+        {
+            Net* net = pin->GetNet();
+            auto driven = net && net->GetDriver() ? pinSupport.find(net->GetDriver()) : pinSupport.end();
+            support |= driven != pinSupport.end() ? driven->second : uint32_t(1) << inputIndex[InputKey(pin.get())];
+        }
+
+        for (const auto& pin : gate->GetOutputPins())
+        {
+            pinSupport[pin.get()] = support;
+            mOutputs.push_back(pin.get());
+            mSupport.push_back(support);
+        }
+    }
+
+    // The compiled circuit may read an input through several pins
+    CompiledCircuit compiled;
+    compiled.Compile(gates);
+    vector<uint32_t> externalInput;
+    for (Pin* pin : compiled.GetExternalPins())
+    {
+        externalInput.push_back(inputIndex[InputKey(pin)]);
+    }
+
+    BitParallelCircuit circuit(compiled);
+    size_t combinations = size_t(1) << mInputs.size();
+    size_t outputs = mOutputs.size();
+    mTable.resize(combinations * outputs);
+    for (size_t first = 0; first < combinations; first += BitParallelCircuit::Lanes)
+    {
+        int lanes = int(min<size_t>(BitParallelCircuit::Lanes, combinations - first));
+        for (int lane = 0; lane < lanes; lane++)
+        {
+            for (size_t e = 0; e < externalInput.size(); e++)
+            {
+                bool one = ((first + lane) >> externalInput[e]) & 1;
+                circuit.SetInput(e, lane, one ? PinState::ONE : PinState::ZERO);
+            }
+        }
+        circuit.Run();
+
+        for (int lane = 0; lane < lanes; lane++)
+        {
+            for (size_t output = 0; output < outputs; output++)
+            {
+                mTable[(first + lane) * outputs + output] = circuit.GetState(output, lane);
+            }
+        }
+    }
+}
+
+/**
+ * Drive the outputs of the cluster from the table
+ */
+void TruthTable::Evaluate()
+{
+    size_t combination = 0;
+    uint32_t unknown = 0;
+    for (size_t i = 0; i < mInputs.size(); i++)
+    {
+        PinState state = mInputs[i]->GetState();
+        if (state == PinState::ONE)
+        {
+            combination |= size_t(1) << i;
+        }
+        else if (state == PinState::UNKNOWN)
+        {
+            unknown |= uint32_t(1) << i;
+        }
+    }
+
+    const PinState* row = mTable.data() + combination * mOutputs.size();
+    for (size_t output = 0; output < mOutputs.size(); output++)
+    {
+        mOutputs[output]->SetState((unknown & mSupport[output]) ? PinState::UNKNOWN : row[output]);
+    }
+}
@@ -0,0 +1,116 @@
+/**
+ * @file TruthTable.h
+ * @author Ethan Springer, Daksh Mehta, Sehaj Gupta, Lukas Schaefer, Jack McNamara
+ *
+ * A small cluster of combinational gates replaced by a lookup table
+ */
+
+#ifndef TRUTHTABLE_H
+#define TRUTHTABLE_H
+
+#include <cstdint>
+#include <vector>
+#include "Gate.h"
+#include "Pin.h"
+
+/**
+ * A small cluster of combinational gates replaced by a lookup table.
+ *
+ * The table holds the state of every output pin of the cluster
+ * for every combination of ZERO and ONE on its inputs, worked
+ * out once with a BitParallelCircuit. Evaluating the cluster
+ * is then one table lookup, however many gates it has.
+ *
+ * Every gate gives an UNKNOWN output for an UNKNOWN input, so
+ * an output is UNKNOWN exactly when one of the inputs it
+ * depends on is. The table only needs the known combinations,
+ * plus a mask for each output of the inputs it depends on.
+ */
+class TruthTable
+{
+public:
+    /// Most inputs a table is built for
+    static const size_t MaxInputs = 16;
+
+private:
+    /// The gates of the cluster, every gate after the gates driving it
+    std::vector<Gate*> mGates;
+
+    /// A pin reading each input of the cluster
+    std::vector<Pin*> mInputs;
+
+    /// Output pins of the gates, in the order of mGates
+    std::vector<Pin*> mOutputs;
+
+    /// For each output, the inputs it depends on, bit n for input n
+    std::vector<uint32_t> mSupport;
+
+    /// Output states, combination * outputs + output
+    std::vector<PinState> mTable;
+
+    /// Logic level the table is evaluated at
+    int mLevel = 0;
+
+    /// True if an input changed since the table was last evaluated
+    bool mDirty = true;
+
+    static void FindInputs(const std::vector<Gate*>& gates, std::vector<Pin*>& inputs);
+
+public:
+    explicit TruthTable(const std::vector<Gate*>& gates);
+
+    /// Copy constructor (disabled)
+    TruthTable(const TruthTable&) = delete;
+
+    /// Assignment operator (disabled)
+    void operator=(const TruthTable&) = delete;
+
+    static size_t CountInputs(const std::vector<Gate*>& gates);
+
+    void Evaluate();
+
+    /**
+     * Get the gates of the cluster
+     * @return Gates, every gate after the gates driving it
+     */
+    const std::vector<Gate*>& GetGates() const { return mGates; }
+
+    /**
+     * Get the number of inputs of the cluster
+     * @return Number of inputs the table is indexed by
+     */
+    size_t GetInputCount() const { return mInputs.size(); }
+
+    /**
+     * Get the number of outputs of the cluster
+     * @return Number of output pins the table drives
+     */
+    size_t GetOutputCount() const { return mOutputs.size(); }
+
+    /**
+     * Getter for the logic level of the table
+     * @return Level of the last gate of the cluster
+     */
+    int GetLevel() const { return mLevel; }
+
+    /**
+     * Setter for the logic level of the table
+     * @param level Level assigned by the netlist
+     */
+    void SetLevel(int level) { mLevel = level; }
+
+    /**
+     * Is the table waiting to be evaluated
+     * @return True if an input changed since the last evaluation
+     */
+    bool IsDirty() const { return mDirty; }
+
+    /**
+     * Setter for the dirty flag, only changed by the netlist
+     * @param dirty True if the table needs to be evaluated
+     */
+    void SetDirty(bool dirty) { mDirty = dirty; }
+};
+
+
+#endif //TRUTHTABLE_H
@@ -29,6 +29,18 @@ enum IDs
 	IDM_ADDNANDGATE = wxID_HIGHEST + 14,
 	IDM_LEVEL_7 = wxID_HIGHEST + 15,
 	IDM_LEVEL_8 = wxID_HIGHEST + 16,
+	IDM_ADDANDGATE3 = wxID_HIGHEST + 17,
+	IDM_ADDANDGATE4 = wxID_HIGHEST + 18,
+	IDM_ADDANDGATE8 = wxID_HIGHEST + 19,
+	IDM_ADDORGATE3 = wxID_HIGHEST + 20,
+	IDM_ADDORGATE4 = wxID_HIGHEST + 21,
+	IDM_ADDORGATE8 = wxID_HIGHEST + 22,
+	IDM_ADDNANDGATE3 = wxID_HIGHEST + 23,
+	IDM_ADDNANDGATE4 = wxID_HIGHEST + 24,
+	IDM_ADDNANDGATE8 = wxID_HIGHEST + 25,
+	IDM_ADDCLOCK = wxID_HIGHEST + 26,
+	IDM_PACKAGEGATES = wxID_HIGHEST + 27,
+	IDM_ADDPACKAGE = wxID_HIGHEST + 28,
 };
 
 #endif //IDS_H
@@ -32,6 +32,21 @@ TEST_F(AndGateTest, BothInputsTrue)
 	ASSERT_EQ(gate->GetPins().size(), 3);
 }
 
+// The pin views point at the pins the gate owns, without copying them
+TEST_F(AndGateTest, PinViews)
+{
+	auto inputs = gate->GetInputPins();
+	auto outputs = gate->GetOutputPins();
+	ASSERT_EQ(inputs.size(), 2);
+	ASSERT_EQ(outputs.size(), 1);
+	ASSERT_EQ(inputs[0]->GetType(), PinType::INPUT);
+	ASSERT_EQ(outputs[0]->GetType(), PinType::OUTPUT);
+	ASSERT_EQ(gate->GetInputPins().begin(), inputs.begin());
+
+	// Only the gate holds references, the views add none
+	ASSERT_EQ(inputs[0].use_count(), 2);
+}
+
 //Test when both inputs are false (0)
 TEST_F(AndGateTest, BothInputsFalse)
 {
@@ -0,0 +1,181 @@
+/**
+ * @file BitParallelTest.cpp
+ * @author Ethan Springer, Daksh Mehta, Sehaj Gupta, Lukas Schaefer, Jack McNamara
+ */
+
+#include <pch.h>
+#include <gtest/gtest.h>
+#include <BitParallelCircuit.h>
+#include <AndGate.h>
+#include <OrGate.h>
+#include <NandGate.h>
+#include <NotGate.h>
+#include <SRFlipFlop.h>
+#include <MacroGate.h>
+#include <MacroDefinition.h>
+#include <Game.h>
+#include <memory>
+
+using namespace std;
+
+/// Every PinState
+static const PinState States[] = {PinState::ZERO, PinState::ONE, PinState::UNKNOWN};
+
+// The two input kernels match the gates for all nine input pairs
+TEST(BitParallelTest, Kernels)
+{
+    Game game;
+    auto andGate = make_shared<AndGate>(&game);
+    auto orGate = make_shared<OrGate>(&game);
+    auto nandGate = make_shared<NandGate>(&game);
+    auto notGate = make_shared<NotGate>(&game);
+
+    DualRail a, b;
+    int lane = 0;
+    for (PinState sa : States)
+    {
+        for (PinState sb : States)
+        {
+            a.Set(lane, sa);
+            b.Set(lane, sb);
+            lane++;
+        }
+    }
+
+    DualRail andOut = DualAnd(a, b);
+    DualRail orOut = DualOr(a, b);
+    DualRail nandOut = DualNand(a, b);
+    DualRail notOut = DualNot(a);
+
+    lane = 0;
+    for (PinState sa : States)
+    {
+        for (PinState sb : States)
+        {
+            for (Gate* gate : {(Gate*)andGate.get(), (Gate*)orGate.get(), (Gate*)nandGate.get()})
+            {
+                gate->GetInputPins()[0]->SetState(sa);
+                gate->GetInputPins()[1]->SetState(sb);
+                gate->calculate();
+            }
+            notGate->GetInputPins()[0]->SetState(sa);
+            notGate->calculate();
+
+            ASSERT_EQ(andOut.Get(lane), andGate->GetOutputPins()[0]->GetState());
+            ASSERT_EQ(orOut.Get(lane), orGate->GetOutputPins()[0]->GetState());
+            ASSERT_EQ(nandOut.Get(lane), nandGate->GetOutputPins()[0]->GetState());
+            ASSERT_EQ(notOut.Get(lane), notGate->GetOutputPins()[0]->GetState());
+            lane++;
+        }
+    }
+}
+
+// The SR kernel sets, resets, holds and goes unknown like the gate
+TEST(BitParallelTest, SRFlipFlop)
+{
+    DualRail s, r, q, qBar;
+    q = DualRail::Broadcast(PinState::ZERO);
+    qBar = DualRail::Broadcast(PinState::ONE);
+
+    s.Set(0, PinState::ONE);
+    r.Set(0, PinState::ZERO);
+    s.Set(1, PinState::ZERO);
+    r.Set(1, PinState::ONE);
+    s.Set(2, PinState::ONE);
+    r.Set(2, PinState::ONE);
+    s.Set(3, PinState::ZERO);
+    r.Set(3, PinState::ZERO);
+    DualSRFlipFlop(s, r, q, qBar);
+
+    ASSERT_EQ(q.Get(0), PinState::ONE);
+    ASSERT_EQ(qBar.Get(0), PinState::ZERO);
+    ASSERT_EQ(q.Get(1), PinState::ZERO);
+    ASSERT_EQ(qBar.Get(1), PinState::ONE);
+    ASSERT_EQ(q.Get(2), PinState::UNKNOWN);
+    ASSERT_EQ(qBar.Get(2), PinState::UNKNOWN);
+    ASSERT_EQ(q.Get(3), PinState::ZERO);
+    ASSERT_EQ(qBar.Get(3), PinState::ONE);
+}
+
+// An exhaustive truth table of a small circuit in one run
+TEST(BitParallelTest, TruthTable)
+{
+    Game game;
+    auto andGate = make_shared<AndGate>(&game);
+    auto orGate = make_shared<OrGate>(&game);
+    auto notGate = make_shared<NotGate>(&game);
+    game.Add(andGate);
+    game.Add(orGate);
+    game.Add(notGate);
+    andGate->GetOutputPins()[0]->ConnectTo(orGate->GetInputPins()[0]);
+    orGate->GetOutputPins()[0]->ConnectTo(notGate->GetInputPins()[0]);
+
+    CompiledCircuit compiled;
+    compiled.Compile(game.GetNetlist()->GetEvaluationOrder());
+
+    BitParallelCircuit circuit(compiled);
+    ASSERT_EQ(circuit.GetInputCount(), 3);
+    circuit.SetExhaustiveInputs(0);
+    circuit.Run();
+
+    // The output of the NOT gate is the last compiled slot
+    size_t out = compiled.GetOutputCount() - 1;
+    for (int lane = 0; lane < 8; lane++)
+    {
+        bool a = lane & 1;
+        bool b = lane & 2;
+        bool c = lane & 4;
+        PinState expected = ((a && b) || c) ? PinState::ZERO : PinState::ONE;
+        ASSERT_EQ(circuit.GetState(out, lane), expected);
+    }
+}
+
+// The circuit keeps its own flip flop states
+TEST(BitParallelTest, FlipFlopLanes)
+{
+    Game game;
+    auto sr = make_shared<SRFlipFlop>(&game);
+    game.Add(sr);
+
+    CompiledCircuit compiled;
+    compiled.Compile(game.GetNetlist()->GetEvaluationOrder());
+    BitParallelCircuit circuit(compiled);
+
+    // Input 0 is R and input 1 is S, set in lane 1 only
+    for (int lane = 0; lane < BitParallelCircuit::Lanes; lane++)
+    {
+        circuit.SetInput(0, lane, PinState::ZERO);
+        circuit.SetInput(1, lane, lane == 1 ? PinState::ONE : PinState::ZERO);
+    }
+    circuit.Run();
+
+    auto q = sr->GetOutputPins()[1]->GetState();
+    ASSERT_EQ(circuit.GetState(1, 0), q);
+    ASSERT_EQ(circuit.GetState(1, 1), PinState::ONE);
+    ASSERT_EQ(circuit.GetState(1, 200), q);
+}
+
+// A circuit with a macro cannot be evaluated in lanes
+TEST(BitParallelTest, RejectsMacros)
+{
+    shared_ptr<MacroDefinition> inverter;
+    {
+        Game game;
+        auto notGate = make_shared<NotGate>(&game);
+        inverter = MacroDefinition::Package({notGate.get()});
+    }
+    ASSERT_NE(inverter, nullptr);
+
+    Game game;
+    auto notGate = make_shared<NotGate>(&game);
+    game.Add(notGate);
+    CompiledCircuit plain;
+    plain.Compile(game.GetNetlist()->GetEvaluationOrder());
+    ASSERT_TRUE(BitParallelCircuit::CanRun(plain));
+
+    auto instance = make_shared<MacroGate>(&game, inverter);
+    game.Add(instance);
+    CompiledCircuit withMacro;
+    withMacro.Compile(game.GetNetlist()->GetEvaluationOrder());
+    ASSERT_FALSE(BitParallelCircuit::CanRun(withMacro));
+}
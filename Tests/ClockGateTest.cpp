@@ -0,0 +1,63 @@
+/**
+ * @file ClockGateTest.cpp
+ * @author Ethan Springer, Daksh Mehta, Sehaj Gupta, Lukas Schaefer, Jack McNamara
+ */
+
+#include <pch.h>
+#include <gtest/gtest.h>
+#include <ClockGate.h>
+#include <DflipFlop.h>
+#include <Game.h>
+#include <memory>
+
+using namespace std;
+
+// The clock changes every half period ticks, however the frames fall
+TEST(ClockGateTest, TicksPerUpdate)
+{
+    Game game;
+    game.SetTickRate(1000);
+    auto clock = make_shared<ClockGate>(&game);
+    clock->SetHalfPeriod(3);
+    game.Add(clock);
+    auto output = clock->GetOutputPins()[0];
+
+    // Ten ticks in one frame, the last half tick is carried over
+    game.Update(0.0105);
+    ASSERT_EQ(game.GetTicks(), 10);
+    ASSERT_EQ(output->GetState(), PinState::ONE);
+
+    game.Update(0.002);
+    ASSERT_EQ(game.GetTicks(), 12);
+    ASSERT_EQ(output->GetState(), PinState::ZERO);
+
+    // A long stall only runs so many ticks
+    game.Update(10.0);
+    ASSERT_EQ(game.GetTicks(), 12 + MaxTicksPerUpdate);
+}
+
+// A flip flop clocked by the clock toggles once per clock period
+TEST(ClockGateTest, DrivesFlipFlop)
+{
+    Game game;
+    auto clock = make_shared<ClockGate>(&game);
+    auto dff = make_shared<DflipFlop>(&game);
+    clock->SetHalfPeriod(1);
+    game.Add(clock);
+    game.Add(dff);
+    clock->GetOutputPins()[0]->ConnectTo(dff->GetInputPins()[1]);
+    dff->GetOutputPins()[1]->ConnectTo(dff->GetInputPins()[0]);
+
+    int toggles = 0;
+    PinState q = dff->GetOutputPins()[0]->GetState();
+    for (int tick = 0; tick < 16; tick++)
+    {
+        game.ComputeAllGates();
+        if (dff->GetOutputPins()[0]->GetState() != q)
+        {
+            q = dff->GetOutputPins()[0]->GetState();
+            toggles++;
+        }
+    }
+    ASSERT_EQ(toggles, 8);
+}
@@ -0,0 +1,160 @@
+/**
+ * @file CompiledCircuitTest.cpp
+ * @author Ethan Springer, Daksh Mehta, Sehaj Gupta, Lukas Schaefer, Jack McNamara
+ */
+
+#include <pch.h>
+#include <gtest/gtest.h>
+#include <CompiledCircuit.h>
+#include <AndGate.h>
+#include <OrGate.h>
+#include <NandGate.h>
+#include <NotGate.h>
+#include <DflipFlop.h>
+#include <SRFlipFlop.h>
+#include <Game.h>
+#include <memory>
+
+using namespace std;
+
+// The compiled circuit computes the same outputs as the gates
+TEST(CompiledCircuitTest, MatchesGates)
+{
+    Game game;
+    auto andGate = make_shared<AndGate>(&game);
+    auto orGate = make_shared<OrGate>(&game);
+    auto nandGate = make_shared<NandGate>(&game);
+    auto notGate = make_shared<NotGate>(&game);
+    game.Add(andGate);
+    game.Add(orGate);
+    game.Add(nandGate);
+    game.Add(notGate);
+    andGate->GetOutputPins()[0]->ConnectTo(notGate->GetInputPins()[0]);
+
+    PinState states[] = {PinState::ZERO, PinState::ONE, PinState::UNKNOWN};
+    for (PinState a : states)
+    {
+        for (PinState b : states)
+        {
+            for (auto gate : {(Gate*)andGate.get(), (Gate*)orGate.get(), (Gate*)nandGate.get()})
+            {
+                gate->GetInputPins()[0]->SetState(a);
+                gate->GetInputPins()[1]->SetState(b);
+            }
+
+            auto netlist = game.GetNetlist();
+            netlist->SetMode(Netlist::EvaluationMode::Full);
+            game.ComputeAllGates();
+            vector<PinState> expected;
+            for (Gate* gate : netlist->GetEvaluationOrder())
+            {
+                expected.push_back(gate->GetOutputPins()[0]->GetState());
+                gate->GetOutputPins()[0]->SetState(PinState::UNKNOWN);
+            }
+
+            netlist->SetMode(Netlist::EvaluationMode::Compiled);
+            game.ComputeAllGates();
+            size_t i = 0;
+            for (Gate* gate : netlist->GetEvaluationOrder())
+            {
+                ASSERT_EQ(gate->GetOutputPins()[0]->GetState(), expected[i++]);
+            }
+        }
+    }
+}
+
+// Wires between gates read the driving slot, other inputs get their own slot
+TEST(CompiledCircuitTest, Slots)
+{
+    Game game;
+    auto not1 = make_shared<NotGate>(&game);
+    auto not2 = make_shared<NotGate>(&game);
+    game.Add(not1);
+    game.Add(not2);
+    not1->GetOutputPins()[0]->ConnectTo(not2->GetInputPins()[0]);
+
+    CompiledCircuit circuit;
+    circuit.Compile(game.GetNetlist()->GetEvaluationOrder());
+    ASSERT_TRUE(circuit.IsLoaded());
+    ASSERT_EQ(circuit.GetProgram().size(), 2);
+    ASSERT_EQ(circuit.GetSlotCount(), 3);
+
+    not1->GetInputPins()[0]->SetState(PinState::ONE);
+    circuit.Run();
+    ASSERT_EQ(not1->GetOutputPins()[0]->GetState(), PinState::ZERO);
+    ASSERT_EQ(not2->GetOutputPins()[0]->GetState(), PinState::ONE);
+
+    circuit.Unload();
+    ASSERT_FALSE(circuit.IsLoaded());
+}
+
+// The program is only compiled again when the wiring changes
+TEST(CompiledCircuitTest, RecompileOnWiring)
+{
+    Game game;
+    auto not1 = make_shared<NotGate>(&game);
+    auto not2 = make_shared<NotGate>(&game);
+    game.Add(not1);
+    game.Add(not2);
+
+    auto netlist = game.GetNetlist();
+    netlist->SetMode(Netlist::EvaluationMode::Compiled);
+    game.ComputeAllGates();
+    ASSERT_TRUE(netlist->GetCompiled().IsLoaded());
+    ASSERT_EQ(netlist->GetCompiled().GetSlotCount(), 4);
+
+    // Changing an input does not change the program
+    not1->GetInputPins()[0]->SetState(PinState::ZERO);
+    ASSERT_TRUE(netlist->GetCompiled().IsLoaded());
+
+    not1->GetOutputPins()[0]->ConnectTo(not2->GetInputPins()[0]);
+    ASSERT_FALSE(netlist->GetCompiled().IsLoaded());
+
+    game.ComputeAllGates();
+    ASSERT_EQ(netlist->GetCompiled().GetSlotCount(), 3);
+    ASSERT_EQ(not2->GetOutputPins()[0]->GetState(), PinState::ZERO);
+}
+
+// Flip flops keep their state across compiles
+TEST(CompiledCircuitTest, FlipFlopMemory)
+{
+    Game game;
+    auto dff = make_shared<DflipFlop>(&game);
+    auto sr = make_shared<SRFlipFlop>(&game);
+    game.Add(dff);
+    game.Add(sr);
+
+    auto netlist = game.GetNetlist();
+    netlist->SetMode(Netlist::EvaluationMode::Compiled);
+
+    auto d = dff->GetInputPins();
+    d[0]->SetState(PinState::ONE);
+    d[1]->SetState(PinState::ZERO);
+    sr->GetInputPins()[1]->SetState(PinState::ONE);
+    game.ComputeAllGates();
+
+    // Clock rises in compiled mode
+    d[1]->SetState(PinState::ONE);
+    game.ComputeAllGates();
+    ASSERT_EQ(dff->GetOutputPins()[0]->GetState(), PinState::ONE);
+    ASSERT_EQ(dff->GetOutputPins()[1]->GetState(), PinState::ZERO);
+
+    // Set is released, the SR flip flop holds
+    sr->GetInputPins()[1]->SetState(PinState::ZERO);
+    game.ComputeAllGates();
+    ASSERT_EQ(sr->GetOutputPins()[0]->GetState(), PinState::ZERO);
+    ASSERT_EQ(sr->GetOutputPins()[1]->GetState(), PinState::ONE);
+
+    // The gates carry on from the compiled state
+    netlist->SetMode(Netlist::EvaluationMode::Full);
+    d[0]->SetState(PinState::ZERO);
+    game.ComputeAllGates();
+    ASSERT_EQ(dff->GetOutputPins()[0]->GetState(), PinState::ONE);
+
+    d[1]->SetState(PinState::ZERO);
+    game.ComputeAllGates();
+    d[1]->SetState(PinState::ONE);
+    game.ComputeAllGates();
+    ASSERT_EQ(dff->GetOutputPins()[0]->GetState(), PinState::ZERO);
+    ASSERT_EQ(dff->GetOutputPins()[1]->GetState(), PinState::ONE);
+}
@@ -8,6 +8,9 @@
 
 #include <Game.h>
 #include <Conveyor.h>
+#include <Product.h>
+#include <ProductVisitor.h>
+#include <algorithm>
 
 TEST(ConveyorTest, TestConveyor) {
     Game game;
@@ -21,4 +24,62 @@ TEST(ConveyorTest, TestConveyor) {
     EXPECT_EQ(conveyor->GetX(), 300);
     EXPECT_EQ(conveyor->GetY(), 200);
     delete node;
-}
\ No newline at end of file
+}
+
+// Range queries on the belt find the same products as visiting them all
+TEST(ConveyorTest, ProductIndex)
+{
+    Game game;
+    auto conveyor = std::make_shared<Conveyor>(&game);
+    game.Add(conveyor);
+    auto node = new wxXmlNode(wxXML_ELEMENT_NODE, L"conveyor");
+    node->AddAttribute(L"x", L"300");
+    node->AddAttribute(L"y", L"200");
+    node->AddAttribute(L"speed", L"100");
+    node->AddAttribute(L"panel", L"0,0");
+    for (int i = 0; i < 50; i++)
+    {
+        auto product = new wxXmlNode(wxXML_ELEMENT_NODE, L"product");
+        product->AddAttribute(L"placement", i == 0 ? L"100" : L"+" + std::to_wstring(50 + i % 7 * 30));
+        node->AddChild(product);
+    }
+    conveyor->XmlLoad(node);
+    delete node;
+
+    auto check = [&game](double y, double x, double range)
+    {
+        ProductVisitor all(y, x, range);
+        game.AcceptProducts(&all);
+        ProductVisitor near(y, x, range);
+        game.AcceptProducts(y, range, &near);
+        auto expected = all.GetProducts();
+        auto found = near.GetProducts();
+        std::sort(expected.begin(), expected.end());
+        std::sort(found.begin(), found.end());
+        ASSERT_EQ(found, expected);
+    };
+
+    // Start the belt and let it carry the products down
+    conveyor->HitTest(340, 230);
+    ASSERT_TRUE(conveyor->IsRunning());
+    for (int tick = 0; tick < 200; tick++)
+    {
+        conveyor->Update(0.05);
+        game.GetProductStore().Update(0.05, conveyor->GetOffset(), 1e9);
+        check(500, 300, ProductDefaultSize);
+        check(250, 300, 300);
+    }
+
+    // A kicked product is still found once it leaves its place on the belt
+    auto products = game.GetRegistry().GetProducts();
+    auto kicked = *std::max_element(products.begin(), products.end(), [](Product* a, Product* b)
+    {
+        return a->GetY() + a->GetYOffset() < b->GetY() + b->GetYOffset();
+    });
+    double y = kicked->GetY() + kicked->GetYOffset();
+    kicked->Kick(100);
+    conveyor->Update(10);
+    ProductVisitor near(y, kicked->GetX() + kicked->GetXOffset());
+    game.AcceptProducts(y, ProductDefaultSize, &near);
+    ASSERT_EQ(near.GetProducts(), std::vector<Product*>({kicked}));
+}
@@ -6,6 +6,7 @@
 #include <pch.h>
 #include <gtest/gtest.h>
 #include <DflipFlop.h>
+#include <NotGate.h>
 #include <Game.h>
 #include <memory>
 #include <Gate.h>
@@ -92,3 +93,76 @@ TEST_F(DflipFlopTest, NoChangeOnStableClock)
     ASSERT_EQ(output[0]->GetState(), PinState::ONE); // Q should still be previous state
     ASSERT_EQ(output[1]->GetState(), PinState::ZERO);  // Q' should still be opposite
 }
+
+// Flip flops sharing a clock all latch the states from before the edge
+TEST(DflipFlopTickTest, ShiftRegister)
+{
+    Game game;
+    auto clock = make_shared<NotGate>(&game);
+    vector<shared_ptr<DflipFlop>> stages;
+    for (int i = 0; i < 3; i++)
+    {
+        stages.push_back(make_shared<DflipFlop>(&game));
+        clock->GetOutputPins()[0]->ConnectTo(stages[i]->GetInputPins()[1]);
+        if (i > 0)
+        {
+            stages[i - 1]->GetOutputPins()[0]->ConnectTo(stages[i]->GetInputPins()[0]);
+        }
+    }
+
+    // Added last stage first, so the order added does not matter
+    for (int i = 2; i >= 0; i--)
+    {
+        game.Add(stages[i]);
+    }
+    game.Add(clock);
+
+    stages[0]->GetInputPins()[0]->SetState(PinState::ONE);
+    clock->GetInputPins()[0]->SetState(PinState::ONE);
+    game.ComputeAllGates();
+
+    for (int edge = 1; edge <= 3; edge++)
+    {
+        // Clock rises
+        clock->GetInputPins()[0]->SetState(PinState::ZERO);
+        game.ComputeAllGates();
+        ASSERT_EQ(game.GetNetlist()->GetEvaluatedCount(), 4);
+        for (int i = 0; i < 3; i++)
+        {
+            ASSERT_EQ(stages[i]->GetOutputPins()[0]->GetState(), i < edge ? PinState::ONE : PinState::ZERO);
+        }
+
+        // Clock falls
+        clock->GetInputPins()[0]->SetState(PinState::ONE);
+        game.ComputeAllGates();
+    }
+}
+
+// A flip flop feeding Q' back to D toggles once per clock edge
+TEST(DflipFlopTickTest, Toggle)
+{
+    Game game;
+    auto gate = make_shared<DflipFlop>(&game);
+    game.Add(gate);
+    gate->GetOutputPins()[1]->ConnectTo(gate->GetInputPins()[0]);
+
+    auto clock = gate->GetInputPins()[1];
+    clock->SetState(PinState::ZERO);
+    game.ComputeAllGates();
+
+    PinState expected = PinState::ZERO;
+    for (int edge = 0; edge < 4; edge++)
+    {
+        expected = expected == PinState::ONE ? PinState::ZERO : PinState::ONE;
+        clock->SetState(PinState::ONE);
+        game.ComputeAllGates();
+        ASSERT_EQ(gate->GetOutputPins()[0]->GetState(), expected);
+
+        // Holding the clock high does not toggle it again
+        game.ComputeAllGates();
+        ASSERT_EQ(gate->GetOutputPins()[0]->GetState(), expected);
+
+        clock->SetState(PinState::ZERO);
+        game.ComputeAllGates();
+    }
+}
@@ -0,0 +1,124 @@
+/**
+ * @file DependencyGraphTest.cpp
+ * @author Ethan Springer, Daksh Mehta, Sehaj Gupta, Lukas Schaefer, Jack McNamara
+ */
+
+#include <pch.h>
+#include <gtest/gtest.h>
+#include <DependencyGraph.h>
+#include <AndGate.h>
+#include <NotGate.h>
+#include <Game.h>
+#include <memory>
+
+using namespace std;
+
+// Dependencies come from the wires between the gates
+TEST(DependencyGraphTest, LevelsFromWires)
+{
+    Game game;
+    auto not1 = make_shared<NotGate>(&game);
+    auto not2 = make_shared<NotGate>(&game);
+    auto andGate = make_shared<AndGate>(&game);
+
+    // not1 -> not2 -> and, not1 -> and
+    not1->GetOutputPins()[0]->ConnectTo(not2->GetInputPins()[0]);
+    not2->GetOutputPins()[0]->ConnectTo(andGate->GetInputPins()[0]);
+    not1->GetOutputPins()[0]->ConnectTo(andGate->GetInputPins()[1]);
+
+    // Deliberately given in reverse order
+    vector<Gate*> gates = {andGate.get(), not2.get(), not1.get()};
+    DependencyGraph graph;
+    graph.BuildDependencyGraph(gates);
+    auto levels = graph.Levelize(gates);
+
+    ASSERT_EQ(levels.size(), 3);
+    ASSERT_EQ(levels[0], vector<Gate*>{not1.get()});
+    ASSERT_EQ(levels[1], vector<Gate*>{not2.get()});
+    ASSERT_EQ(levels[2], vector<Gate*>{andGate.get()});
+}
+
+// A chain of gates settles in a single evaluation
+TEST(DependencyGraphTest, SettlesInOnePass)
+{
+    Game game;
+    vector<shared_ptr<NotGate>> chain;
+    for (int i = 0; i < 8; i++)
+    {
+        chain.push_back(make_shared<NotGate>(&game));
+    }
+
+    // Add them to the game last to first so item order is the worst case
+    for (auto i = chain.rbegin(); i != chain.rend(); i++)
+    {
+        game.Add(*i);
+    }
+    for (size_t i = 1; i < chain.size(); i++)
+    {
+        chain[i - 1]->GetOutputPins()[0]->ConnectTo(chain[i]->GetInputPins()[0]);
+    }
+
+    chain[0]->GetInputPins()[0]->SetState(PinState::ONE);
+    game.ComputeAllGates();
+    ASSERT_EQ(chain.back()->GetOutputPins()[0]->GetState(), PinState::ONE);
+    ASSERT_EQ(chain.back()->GetLevel(), 7);
+
+    chain[0]->GetInputPins()[0]->SetState(PinState::ZERO);
+    game.ComputeAllGates();
+    ASSERT_EQ(chain.back()->GetOutputPins()[0]->GetState(), PinState::ZERO);
+}
+
+// A feedback loop does not stop the other gates from being evaluated
+TEST(DependencyGraphTest, FeedbackLoop)
+{
+    Game game;
+    auto not1 = make_shared<NotGate>(&game);
+    auto not2 = make_shared<NotGate>(&game);
+    auto not3 = make_shared<NotGate>(&game);
+    game.Add(not1);
+    game.Add(not2);
+    game.Add(not3);
+
+    not1->GetOutputPins()[0]->ConnectTo(not2->GetInputPins()[0]);
+    not2->GetOutputPins()[0]->ConnectTo(not1->GetInputPins()[0]);
+
+    // The loop is levelled as one unit, driven by nothing
+    auto levels = game.GetNetlist()->GetLevels();
+    ASSERT_EQ(levels.size(), 1);
+    ASSERT_EQ(levels[0].size(), 3);
+
+    auto loops = game.GetNetlist()->GetLoops();
+    ASSERT_EQ(loops.size(), 1);
+    ASSERT_EQ(loops[0].size(), 2);
+    ASSERT_EQ(not1->GetLoop(), 0);
+    ASSERT_EQ(not3->GetLoop(), -1);
+}
+
+// Gates driven by a loop come after it, gates driving it come before
+TEST(DependencyGraphTest, LoopLevels)
+{
+    Game game;
+    auto before = make_shared<NotGate>(&game);
+    auto loop1 = make_shared<AndGate>(&game);
+    auto loop2 = make_shared<NotGate>(&game);
+    auto after = make_shared<NotGate>(&game);
+
+    before->GetOutputPins()[0]->ConnectTo(loop1->GetInputPins()[0]);
+    loop1->GetOutputPins()[0]->ConnectTo(loop2->GetInputPins()[0]);
+    loop2->GetOutputPins()[0]->ConnectTo(loop1->GetInputPins()[1]);
+    loop2->GetOutputPins()[0]->ConnectTo(after->GetInputPins()[0]);
+
+    vector<Gate*> gates = {after.get(), loop2.get(), loop1.get(), before.get()};
+    DependencyGraph graph;
+    graph.BuildDependencyGraph(gates);
+
+    auto levels = graph.Levelize(gates);
+    ASSERT_EQ(levels.size(), 3);
+    ASSERT_EQ(levels[0], vector<Gate*>{before.get()});
+    ASSERT_EQ(levels[1], (vector<Gate*>{loop2.get(), loop1.get()}));
+    ASSERT_EQ(levels[2], vector<Gate*>{after.get()});
+
+    auto components = graph.Components(gates);
+    ASSERT_EQ(components.size(), 3);
+    ASSERT_EQ(graph.FindLoops(gates).size(), 1);
+}
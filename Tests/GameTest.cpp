@@ -5,3 +5,191 @@
 
 #include <pch.h>
 #include "gtest/gtest.h"
+#include <Game.h>
+#include <Beam.h>
+#include <NotGate.h>
+#include <OrGate.h>
+#include <Product.h>
+#include <Sparty.h>
+
+using namespace std;
+
+// Items are sorted into the registry by type as they are added
+TEST(GameTest, Registry)
+{
+    Game game;
+    ASSERT_EQ(game.GetRegistry().GetSparty(), nullptr);
+    ASSERT_EQ(game.GetRegistry().GetConveyor(), nullptr);
+
+    auto sparty = make_shared<Sparty>(&game);
+    auto gate = make_shared<NotGate>(&game);
+    auto product1 = make_shared<Product>(&game, 0);
+    auto product2 = make_shared<Product>(&game, 100);
+    game.Add(sparty);
+    game.Add(product1);
+    game.Add(gate);
+    game.Add(product2);
+
+    auto& registry = game.GetRegistry();
+    ASSERT_EQ(registry.GetSparty(), sparty.get());
+    ASSERT_EQ(registry.GetProducts(), vector<Product*>({product1.get(), product2.get()}));
+    ASSERT_EQ(registry.GetGates(), vector<Gate*>({gate.get()}));
+    ASSERT_TRUE(registry.GetSensors().empty());
+
+    game.Clear();
+    ASSERT_EQ(registry.GetSparty(), nullptr);
+    ASSERT_TRUE(registry.GetProducts().empty());
+    ASSERT_TRUE(registry.GetGates().empty());
+}
+
+// Hit tests find the topmost gate and its pins wherever it has moved
+TEST(GameTest, HitTest)
+{
+    Game game;
+    vector<shared_ptr<NotGate>> gates;
+    for (int i = 0; i < 100; i++)
+    {
+        gates.push_back(make_shared<NotGate>(&game));
+        gates.back()->SetLocation(100 + (i % 10) * 200, 100 + (i / 10) * 200);
+        game.Add(gates.back());
+    }
+
+    ASSERT_EQ(game.HitTest(300, 100), gates[1]);
+    ASSERT_EQ(game.HitTest(150, 200), nullptr);
+
+    // A gate dropped on another is on top until the other is raised
+    gates[2]->SetLocation(300, 100);
+    ASSERT_EQ(game.HitTest(300, 100), gates[2]);
+    game.MoveBack(gates[1]);
+    ASSERT_EQ(game.HitTest(300, 100), gates[1]);
+    ASSERT_EQ(game.HitTest(500, 100), nullptr);
+
+    // Pins are found once the gate has updated their positions
+    gates[55]->SetLocation(1000, 1000);
+    gates[55]->Update(0);
+    auto input = gates[55]->GetInputPins()[0];
+    ASSERT_EQ(game.PinHitTest(input->GetAbsoluteX(), input->GetAbsoluteY()), input);
+}
+
+// Level items are gone after Clear and the next level can be made in the same memory
+TEST(GameTest, LevelArena)
+{
+    Game game;
+    for (int level = 0; level < 3; level++)
+    {
+        vector<Handle> handles;
+        for (int i = 0; i < 100; i++)
+        {
+            auto product = game.MakeLevelItem<Product>(i * 100.0);
+            game.Add(product);
+            handles.push_back(product->GetHandle());
+        }
+        auto gate = game.MakeGate<NotGate>();
+        game.Add(gate);
+        handles.push_back(gate->GetHandle());
+        gate.reset();
+
+        ASSERT_EQ(game.GetRegistry().GetProducts().size(), 100);
+        game.Clear();
+        for (auto handle : handles)
+        {
+            ASSERT_EQ(game.GetItem(handle), nullptr);
+        }
+    }
+}
+
+// Clearing a level frees every gate and pin, however they are wired
+TEST(GameTest, ClearFreesWires)
+{
+    // The counts are for the whole program, so compare to where they start
+    Game game;
+    size_t gatesBefore = Gate::GetLiveCount();
+    size_t pinsBefore = Pin::GetLiveCount();
+
+    for (int level = 0; level < 5; level++)
+    {
+        auto node = new wxXmlNode(wxXML_ELEMENT_NODE, L"beam");
+        node->AddAttribute(L"x", L"242");
+        node->AddAttribute(L"y", L"437");
+        game.XmlItem(node);
+        delete node;
+        Beam* beam = game.GetRegistry().GetBeams().back();
+
+        // The beam and the end of a chain of gates both drive its head
+        auto head = game.MakeGate<OrGate>();
+        game.Add(head);
+        beam->GetPin()->ConnectTo(head->GetInputPins()[0]);
+
+        vector<shared_ptr<NotGate>> gates;
+        for (int i = 0; i < 20; i++)
+        {
+            gates.push_back(game.MakeGate<NotGate>());
+            game.Add(gates.back());
+            Gate* previous = i > 0 ? static_cast<Gate*>(gates[i - 1].get()) : head.get();
+            previous->GetOutputPins()[0]->ConnectTo(gates[i]->GetInputPins()[0]);
+        }
+        gates.back()->GetOutputPins()[0]->ConnectTo(head->GetInputPins()[1]);
+        game.ComputeAllGates();
+        ASSERT_EQ(Gate::GetLiveCount(), gatesBefore + 21);
+
+        head.reset();
+        gates.clear();
+        game.Clear();
+        ASSERT_EQ(Gate::GetLiveCount(), gatesBefore);
+        ASSERT_EQ(Pin::GetLiveCount(), pinsBefore);
+    }
+}
+
+// An update with no time passed, as on loading a level, still places the pins
+TEST(GameTest, ZeroUpdatePlacesPins)
+{
+    Game game;
+    auto gate = make_shared<NotGate>(&game);
+    gate->SetLocation(500, 300);
+    game.Add(gate);
+
+    game.Update(0, true);
+    auto input = gate->GetInputPins()[0];
+    ASSERT_DOUBLE_EQ(input->GetAbsoluteX(), 500 + input->GetRelativeX());
+    ASSERT_DOUBLE_EQ(input->GetAbsoluteY(), 300 + input->GetRelativeY());
+}
+
+// Only gates are selected, clicking again deselects, and a new level forgets them
+TEST(GameTest, Selection)
+{
+    Game game;
+    auto gate1 = game.MakeGate<NotGate>();
+    auto gate2 = game.MakeGate<NotGate>();
+    auto sparty = make_shared<Sparty>(&game);
+    game.Add(gate1);
+    game.Add(gate2);
+    game.Add(sparty);
+
+    game.ToggleSelected(gate2.get());
+    game.ToggleSelected(sparty.get());
+    game.ToggleSelected(gate1.get());
+    ASSERT_EQ(game.GetSelectedGates(), vector<Gate*>({gate2.get(), gate1.get()}));
+
+    game.ToggleSelected(gate2.get());
+    ASSERT_EQ(game.GetSelectedGates(), vector<Gate*>({gate1.get()}));
+
+    game.Clear();
+    ASSERT_TRUE(game.GetSelectedGates().empty());
+}
+
+// Products ignore clicks, so however many there are a click does not test them
+TEST(GameTest, ProductsNotHitTested)
+{
+    Game game;
+    auto gate = game.MakeGate<NotGate>();
+    auto sparty = make_shared<Sparty>(&game);
+    game.Add(gate);
+    game.Add(sparty);
+    for (int i = 0; i < 1000; i++)
+    {
+        game.Add(game.MakeLevelItem<Product>(i * 10.0));
+    }
+
+    ASSERT_EQ(game.GetRegistry().GetProducts().size(), 1000);
+    ASSERT_EQ(game.GetGrid().GetCount(), 2);
+}
@@ -0,0 +1,55 @@
+/**
+ * @file HandlePoolTest.cpp
+ * @author Ethan Springer, Daksh Mehta, Sehaj Gupta, Lukas Schaefer, Jack McNamara
+ */
+
+#include <pch.h>
+#include <gtest/gtest.h>
+#include <HandlePool.h>
+#include <Game.h>
+#include <NotGate.h>
+#include <memory>
+
+using namespace std;
+
+// Freed slots are reused and old handles to them go stale
+TEST(HandlePoolTest, Stale)
+{
+    HandlePool<int> pool;
+    int a = 1, b = 2, c = 3;
+    Handle ha = pool.Add(&a);
+    Handle hb = pool.Add(&b);
+    ASSERT_EQ(pool.Get(ha), &a);
+    ASSERT_EQ(pool.Get(hb), &b);
+    ASSERT_EQ(pool.Get(Handle()), nullptr);
+
+    pool.Remove(ha);
+    ASSERT_EQ(pool.Get(ha), nullptr);
+    ASSERT_EQ(pool.GetCount(), 1);
+
+    Handle hc = pool.Add(&c);
+    ASSERT_EQ(hc.GetIndex(), ha.GetIndex());
+    ASSERT_NE(hc, ha);
+    ASSERT_EQ(pool.Get(ha), nullptr);
+    ASSERT_EQ(pool.Get(hc), &c);
+    ASSERT_EQ(pool.GetCapacity(), 2);
+
+    // Removing through a stale handle does nothing
+    pool.Remove(ha);
+    ASSERT_EQ(pool.Get(hc), &c);
+}
+
+// Items and their pins can be found by handle until destroyed
+TEST(HandlePoolTest, Items)
+{
+    Game game;
+    auto gate = make_shared<NotGate>(&game);
+    Handle handle = gate->GetHandle();
+    Handle pin = gate->GetInputPins()[0]->GetHandle();
+    ASSERT_EQ(game.GetItem(handle), gate.get());
+    ASSERT_EQ(game.GetItem(pin), gate->GetInputPins()[0].get());
+
+    gate.reset();
+    ASSERT_EQ(game.GetItem(handle), nullptr);
+    ASSERT_EQ(game.GetItem(pin), nullptr);
+}
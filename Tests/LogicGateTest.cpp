@@ -0,0 +1,89 @@
+/**
+ * @file LogicGateTest.cpp
+ * @author Ethan Springer, Daksh Mehta, Sehaj Gupta, Lukas Schaefer, Jack McNamara
+ */
+
+#include <pch.h>
+#include <gtest/gtest.h>
+#include <AndGate.h>
+#include <OrGate.h>
+#include <NandGate.h>
+#include <Game.h>
+#include <memory>
+
+using namespace std;
+
+// The truth functions can be evaluated at compile time
+static_assert(AndOp::Evaluate(std::array<PinState, 3>{PinState::ONE, PinState::ONE, PinState::ONE}) == PinState::ONE,
+              "AND of all ones is one");
+static_assert(OrOp::Evaluate(std::array<PinState, 4>{}) == PinState::ZERO, "OR of all zeros is zero");
+static_assert(NandOp::Evaluate(std::array<PinState, 2>{PinState::ONE, PinState::UNKNOWN}) == PinState::UNKNOWN,
+              "NAND of an unknown is unknown");
+
+// Wide gates have one input pin per input and keep the pin spacing
+TEST(LogicGateTest, Pins)
+{
+    Game game;
+    auto and2 = make_shared<AndGate>(&game);
+    auto and8 = make_shared<AndGate8>(&game);
+
+    ASSERT_EQ(and2->GetInputPins().size(), 2);
+    ASSERT_EQ(and8->GetInputPins().size(), 8);
+    ASSERT_EQ(and8->GetOutputPins().size(), 1);
+    ASSERT_EQ(and8->GetSize().GetHeight(), 4 * and2->GetSize().GetHeight());
+}
+
+// Every input of a wide gate takes part in the result
+TEST(LogicGateTest, WideInputs)
+{
+    Game game;
+    auto andGate = make_shared<AndGate4>(&game);
+    auto orGate = make_shared<OrGate4>(&game);
+    auto nandGate = make_shared<NandGate4>(&game);
+
+    for (int low = 0; low < 4; low++)
+    {
+        for (int i = 0; i < 4; i++)
+        {
+            PinState state = i == low ? PinState::ZERO : PinState::ONE;
+            andGate->GetInputPins()[i]->SetState(state);
+            nandGate->GetInputPins()[i]->SetState(state);
+            orGate->GetInputPins()[i]->SetState(i == low ? PinState::ONE : PinState::ZERO);
+        }
+        andGate->calculate();
+        orGate->calculate();
+        nandGate->calculate();
+        ASSERT_EQ(andGate->GetOutputPins()[0]->GetState(), PinState::ZERO);
+        ASSERT_EQ(orGate->GetOutputPins()[0]->GetState(), PinState::ONE);
+        ASSERT_EQ(nandGate->GetOutputPins()[0]->GetState(), PinState::ONE);
+    }
+
+    andGate->GetInputPins()[0]->SetState(PinState::ONE);
+    andGate->GetInputPins()[3]->SetState(PinState::ONE);
+    andGate->calculate();
+    ASSERT_EQ(andGate->GetOutputPins()[0]->GetState(), PinState::ONE);
+
+    andGate->GetInputPins()[2]->SetState(PinState::UNKNOWN);
+    andGate->calculate();
+    ASSERT_EQ(andGate->GetOutputPins()[0]->GetState(), PinState::UNKNOWN);
+}
+
+// The compiled circuit handles any number of inputs
+TEST(LogicGateTest, Compiled)
+{
+    Game game;
+    auto gate = make_shared<OrGate8>(&game);
+    game.Add(gate);
+    game.GetNetlist()->SetMode(Netlist::EvaluationMode::Compiled);
+
+    for (const auto& pin : gate->GetInputPins())
+    {
+        pin->SetState(PinState::ZERO);
+    }
+    game.ComputeAllGates();
+    ASSERT_EQ(gate->GetOutputPins()[0]->GetState(), PinState::ZERO);
+
+    gate->GetInputPins()[7]->SetState(PinState::ONE);
+    game.ComputeAllGates();
+    ASSERT_EQ(gate->GetOutputPins()[0]->GetState(), PinState::ONE);
+}
@@ -0,0 +1,194 @@
+/**
+ * @file MacroGateTest.cpp
+ * @author Ethan Springer, Daksh Mehta, Sehaj Gupta, Lukas Schaefer, Jack McNamara
+ */
+
+#include <pch.h>
+#include <gtest/gtest.h>
+#include <MacroGate.h>
+#include <MacroDefinition.h>
+#include <ClockGate.h>
+#include <DflipFlop.h>
+#include <NandGate.h>
+#include <NotGate.h>
+#include <Netlist.h>
+#include <Game.h>
+#include <memory>
+
+using namespace std;
+
+/**
+ * Package an XOR made of two NOT gates buffering the
+ * inputs and four NAND gates
+ * @return The definition, built from gates that are then destroyed
+ */
+static shared_ptr<MacroDefinition> PackageXor()
+{
+    Game game;
+    auto a = make_shared<NotGate>(&game);
+    auto b = make_shared<NotGate>(&game);
+    vector<shared_ptr<NandGate>> nands;
+    for (int i = 0; i < 4; i++)
+    {
+        nands.push_back(make_shared<NandGate>(&game));
+    }
+
+    auto connect = [](const shared_ptr<Gate>& from, const shared_ptr<Gate>& to, int input)
+    {
+        from->GetOutputPins()[0]->ConnectTo(to->GetInputPins()[input]);
+    };
+    connect(a, nands[0], 0);
+    connect(b, nands[0], 1);
+    connect(a, nands[1], 0);
+    connect(nands[0], nands[1], 1);
+    connect(b, nands[2], 0);
+    connect(nands[0], nands[2], 1);
+    connect(nands[1], nands[3], 0);
+    connect(nands[2], nands[3], 1);
+
+    return MacroDefinition::Package({a.get(), b.get(), nands[0].get(), nands[1].get(),
+                                     nands[2].get(), nands[3].get()});
+}
+
+// Every instance computes the packaged function from its own state
+TEST(MacroGateTest, Instances)
+{
+    auto xorMacro = PackageXor();
+    ASSERT_NE(xorMacro, nullptr);
+    ASSERT_EQ(xorMacro->GetGateCount(), 6);
+    ASSERT_EQ(xorMacro->GetInputCount(), 2);
+    ASSERT_EQ(xorMacro->GetOutputCount(), 1);
+
+    for (auto mode : {Netlist::EvaluationMode::EventDriven, Netlist::EvaluationMode::Compiled})
+    {
+        Game game;
+        game.GetNetlist()->SetMode(mode);
+        vector<shared_ptr<MacroGate>> instances;
+        for (int i = 0; i < 4; i++)
+        {
+            instances.push_back(make_shared<MacroGate>(&game, xorMacro));
+            game.Add(instances.back());
+            instances[i]->GetInputPins()[0]->SetState(i & 1 ? PinState::ONE : PinState::ZERO);
+            instances[i]->GetInputPins()[1]->SetState(i & 2 ? PinState::ONE : PinState::ZERO);
+        }
+        game.ComputeAllGates();
+
+        for (int i = 0; i < 4; i++)
+        {
+            bool expected = ((i & 1) != 0) != ((i & 2) != 0);
+            ASSERT_EQ(instances[i]->GetOutputPins()[0]->GetState(), expected ? PinState::ONE : PinState::ZERO);
+            ASSERT_EQ(instances[i]->GetDefinition(), xorMacro);
+        }
+
+        // Changing one instance leaves the others alone
+        instances[0]->GetInputPins()[0]->SetState(PinState::ONE);
+        game.ComputeAllGates();
+        ASSERT_EQ(instances[0]->GetOutputPins()[0]->GetState(), PinState::ONE);
+        ASSERT_EQ(instances[3]->GetOutputPins()[0]->GetState(), PinState::ZERO);
+    }
+}
+
+// Groups the program cannot run in one pass are not packaged
+TEST(MacroGateTest, Rejected)
+{
+    Game game;
+    auto nand1 = make_shared<NandGate>(&game);
+    auto nand2 = make_shared<NandGate>(&game);
+    nand1->GetOutputPins()[0]->ConnectTo(nand2->GetInputPins()[0]);
+    nand2->GetOutputPins()[0]->ConnectTo(nand1->GetInputPins()[1]);
+    ASSERT_EQ(MacroDefinition::Package({nand1.get(), nand2.get()}), nullptr);
+
+    auto clock = make_shared<ClockGate>(&game);
+    ASSERT_EQ(MacroDefinition::Package({clock.get()}), nullptr);
+    ASSERT_EQ(MacroDefinition::Package({}), nullptr);
+}
+
+// A package cannot hold another package, which may be freed before it
+TEST(MacroGateTest, Nested)
+{
+    auto xorMacro = PackageXor();
+    ASSERT_NE(xorMacro, nullptr);
+
+    Game game;
+    auto instance = make_shared<MacroGate>(&game, xorMacro);
+    auto notGate = make_shared<NotGate>(&game);
+    instance->GetOutputPins()[0]->ConnectTo(notGate->GetInputPins()[0]);
+    ASSERT_EQ(MacroDefinition::Package({instance.get(), notGate.get()}), nullptr);
+    ASSERT_EQ(MacroDefinition::Package({instance.get()}), nullptr);
+    ASSERT_NE(MacroDefinition::Package({notGate.get()}), nullptr);
+}
+
+// A packaged flip flop is latched once per tick
+TEST(MacroGateTest, Sequential)
+{
+    shared_ptr<MacroDefinition> toggle;
+    {
+        Game game;
+        auto dff = make_shared<DflipFlop>(&game);
+        dff->GetOutputPins()[1]->ConnectTo(dff->GetInputPins()[0]);
+        toggle = MacroDefinition::Package({dff.get()});
+    }
+    ASSERT_NE(toggle, nullptr);
+    ASSERT_TRUE(toggle->IsSequential());
+    ASSERT_EQ(toggle->GetInputCount(), 1);
+    ASSERT_EQ(toggle->GetOutputCount(), 1);
+
+    Game game;
+    auto clock = make_shared<ClockGate>(&game);
+    auto instance = make_shared<MacroGate>(&game, toggle);
+    clock->SetHalfPeriod(1);
+    game.Add(clock);
+    game.Add(instance);
+    clock->GetOutputPins()[0]->ConnectTo(instance->GetInputPins()[0]);
+
+    int toggles = 0;
+    PinState q = instance->GetOutputPins()[0]->GetState();
+    for (int tick = 0; tick < 16; tick++)
+    {
+        game.ComputeAllGates();
+        if (instance->GetOutputPins()[0]->GetState() != q)
+        {
+            q = instance->GetOutputPins()[0]->GetState();
+            toggles++;
+        }
+    }
+    ASSERT_EQ(toggles, 8);
+}
+
+// An unwired input does not freeze the outputs that do not read it
+TEST(MacroGateTest, OptimizeUnwiredInput)
+{
+    // Two separate NOT gates, one output for each input
+    shared_ptr<MacroDefinition> pair;
+    {
+        Game game;
+        auto not1 = make_shared<NotGate>(&game);
+        auto not2 = make_shared<NotGate>(&game);
+        pair = MacroDefinition::Package({not1.get(), not2.get()});
+    }
+    ASSERT_NE(pair, nullptr);
+    ASSERT_EQ(pair->GetInputCount(), 2);
+    ASSERT_EQ(pair->GetOutputCount(), 2);
+
+    Game game;
+    game.GetNetlist()->SetOptimize(true);
+    auto instance = make_shared<MacroGate>(&game, pair);
+    game.Add(instance);
+
+    // A pin outside the netlist, like a beam's, drives the second input
+    auto source = make_shared<Pin>(&game, PinType::OUTPUT, 0, 0, PinState::ONE);
+    auto sink1 = make_shared<Pin>(&game, PinType::INPUT, 0, 0);
+    auto sink2 = make_shared<Pin>(&game, PinType::INPUT, 0, 0);
+    instance->GetInputPins()[0]->SetState(PinState::UNKNOWN);
+    source->ConnectTo(instance->GetInputPins()[1]);
+    instance->GetOutputPins()[0]->ConnectTo(sink1);
+    instance->GetOutputPins()[1]->ConnectTo(sink2);
+
+    game.ComputeAllGates();
+    ASSERT_EQ(instance->GetRole(), GateRole::Evaluated);
+    ASSERT_EQ(instance->GetOutputPins()[1]->GetState(), PinState::ZERO);
+
+    source->SetState(PinState::ZERO);
+    game.ComputeAllGates();
+    ASSERT_EQ(instance->GetOutputPins()[1]->GetState(), PinState::ONE);
+}
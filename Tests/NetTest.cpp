@@ -0,0 +1,85 @@
+/**
+ * @file NetTest.cpp
+ * @author Ethan Springer, Daksh Mehta, Sehaj Gupta, Lukas Schaefer, Jack McNamara
+ */
+
+#include <pch.h>
+#include <gtest/gtest.h>
+#include <Net.h>
+#include <NotGate.h>
+#include <Game.h>
+#include <memory>
+
+using namespace std;
+
+// Every input wired to an output reads the same net
+TEST(NetTest, FanOut)
+{
+    Game game;
+    auto driver = make_shared<NotGate>(&game);
+    vector<shared_ptr<NotGate>> sinks;
+    for (int i = 0; i < 3; i++)
+    {
+        sinks.push_back(make_shared<NotGate>(&game));
+        driver->GetOutputPins()[0]->ConnectTo(sinks.back()->GetInputPins()[0]);
+    }
+
+    auto output = driver->GetOutputPins()[0];
+    Net* net = output->GetNet();
+    ASSERT_EQ(net->GetDriver(), output.get());
+    ASSERT_EQ(net->GetSinks().size(), 3);
+
+    output->SetState(PinState::ONE);
+    for (auto& sink : sinks)
+    {
+        ASSERT_EQ(sink->GetInputPins()[0]->GetNet(), net);
+        ASSERT_EQ(sink->GetInputPins()[0]->GetState(), PinState::ONE);
+    }
+
+    output->SetState(PinState::ZERO);
+    ASSERT_EQ(sinks[2]->GetInputPins()[0]->GetState(), PinState::ZERO);
+}
+
+// Only the driver writes a wired input, and unwiring keeps the last state
+TEST(NetTest, SingleWriter)
+{
+    Game game;
+    auto driver = make_shared<NotGate>(&game);
+    auto sink = make_shared<NotGate>(&game);
+    auto output = driver->GetOutputPins()[0];
+    auto input = sink->GetInputPins()[0];
+
+    output->SetState(PinState::ONE);
+    output->ConnectTo(input);
+    ASSERT_EQ(input->GetState(), PinState::ONE);
+
+    input->SetState(PinState::ZERO);
+    ASSERT_EQ(input->GetState(), PinState::ONE);
+
+    input->ClearConnectedPins();
+    ASSERT_EQ(input->GetNet(), nullptr);
+    ASSERT_TRUE(output->GetNet()->GetSinks().empty());
+    ASSERT_EQ(input->GetState(), PinState::ONE);
+
+    output->SetState(PinState::ZERO);
+    ASSERT_EQ(input->GetState(), PinState::ONE);
+}
+
+// Wiring an input to another output moves it to that net
+TEST(NetTest, Rewire)
+{
+    Game game;
+    auto driver1 = make_shared<NotGate>(&game);
+    auto driver2 = make_shared<NotGate>(&game);
+    auto sink = make_shared<NotGate>(&game);
+    auto input = sink->GetInputPins()[0];
+
+    driver1->GetOutputPins()[0]->SetState(PinState::ONE);
+    driver2->GetOutputPins()[0]->SetState(PinState::ZERO);
+
+    driver1->GetOutputPins()[0]->ConnectTo(input);
+    driver2->GetOutputPins()[0]->ConnectTo(input);
+    ASSERT_TRUE(driver1->GetOutputPins()[0]->GetNet()->GetSinks().empty());
+    ASSERT_EQ(input->GetNet(), driver2->GetOutputPins()[0]->GetNet());
+    ASSERT_EQ(input->GetState(), PinState::ZERO);
+}
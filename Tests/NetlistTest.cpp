@@ -0,0 +1,321 @@
+/**
+ * @file NetlistTest.cpp
+ * @author Ethan Springer, Daksh Mehta, Sehaj Gupta, Lukas Schaefer, Jack McNamara
+ */
+
+#include <pch.h>
+#include <gtest/gtest.h>
+#include <Netlist.h>
+#include <AndGate.h>
+#include <NandGate.h>
+#include <NotGate.h>
+#include <OrGate.h>
+#include <Game.h>
+#include <memory>
+
+using namespace std;
+
+// Gates added to the game are tracked by its netlist
+TEST(NetlistTest, AddAndClear)
+{
+    Game game;
+    auto andGate = make_shared<AndGate>(&game);
+    auto notGate = make_shared<NotGate>(&game);
+    game.Add(andGate);
+    game.Add(notGate);
+
+    auto netlist = game.GetNetlist();
+    ASSERT_EQ(netlist->GetGates().size(), 2);
+    ASSERT_EQ(netlist->GetEvaluationOrder().size(), 2);
+
+    game.Clear();
+    ASSERT_TRUE(netlist->GetGates().empty());
+    ASSERT_TRUE(netlist->GetEvaluationOrder().empty());
+}
+
+// Removing a gate drops it from the cached evaluation order
+TEST(NetlistTest, RemoveGate)
+{
+    Game game;
+    auto gate1 = make_shared<AndGate>(&game);
+    auto gate2 = make_shared<AndGate>(&game);
+
+    Netlist netlist;
+    netlist.AddGate(gate1.get());
+    netlist.AddGate(gate2.get());
+    ASSERT_EQ(netlist.GetEvaluationOrder().size(), 2);
+
+    netlist.RemoveGate(gate1.get());
+    auto order = netlist.GetEvaluationOrder();
+    ASSERT_EQ(order.size(), 1);
+    ASSERT_EQ(order[0], gate2.get());
+}
+
+// Evaluating the netlist computes every gate
+TEST(NetlistTest, Evaluate)
+{
+    Game game;
+    auto gate = make_shared<NotGate>(&game);
+    game.Add(gate);
+
+    gate->GetInputPins()[0]->SetState(PinState::ZERO);
+    game.ComputeAllGates();
+    ASSERT_EQ(gate->GetOutputPins()[0]->GetState(), PinState::ONE);
+}
+
+// Only gates downstream of a changed input are calculated
+TEST(NetlistTest, EventDriven)
+{
+    Game game;
+    auto not1 = make_shared<NotGate>(&game);
+    auto not2 = make_shared<NotGate>(&game);
+    auto other = make_shared<NotGate>(&game);
+    game.Add(not1);
+    game.Add(not2);
+    game.Add(other);
+    not1->GetOutputPins()[0]->ConnectTo(not2->GetInputPins()[0]);
+
+    auto netlist = game.GetNetlist();
+    game.ComputeAllGates();
+    ASSERT_EQ(netlist->GetEvaluatedCount(), 3);
+
+    // Nothing changed, nothing to do
+    game.ComputeAllGates();
+    ASSERT_EQ(netlist->GetEvaluatedCount(), 0);
+
+    // The change ripples through the chain but not to the other gate
+    not1->GetInputPins()[0]->SetState(PinState::ONE);
+    game.ComputeAllGates();
+    ASSERT_EQ(netlist->GetEvaluatedCount(), 2);
+    ASSERT_EQ(not2->GetOutputPins()[0]->GetState(), PinState::ONE);
+
+    // Setting the same state again is not a change
+    not1->GetInputPins()[0]->SetState(PinState::ONE);
+    game.ComputeAllGates();
+    ASSERT_EQ(netlist->GetEvaluatedCount(), 0);
+
+    // Full evaluation still calculates everything
+    netlist->SetMode(Netlist::EvaluationMode::Full);
+    game.ComputeAllGates();
+    ASSERT_EQ(netlist->GetEvaluatedCount(), 3);
+}
+
+// A latch made from two NAND gates settles within one Evaluate
+TEST(NetlistTest, NandLatch)
+{
+    Game game;
+    auto nand1 = make_shared<NandGate>(&game);
+    auto nand2 = make_shared<NandGate>(&game);
+    game.Add(nand1);
+    game.Add(nand2);
+    nand1->GetOutputPins()[0]->ConnectTo(nand2->GetInputPins()[0]);
+    nand2->GetOutputPins()[0]->ConnectTo(nand1->GetInputPins()[1]);
+
+    // Start holding Q = 1
+    auto q = nand1->GetOutputPins()[0];
+    auto qBar = nand2->GetOutputPins()[0];
+    q->SetState(PinState::ONE);
+    qBar->SetState(PinState::ZERO);
+    nand1->GetInputPins()[0]->SetState(PinState::ONE);
+    nand2->GetInputPins()[1]->SetState(PinState::ONE);
+    game.ComputeAllGates();
+    ASSERT_EQ(q->GetState(), PinState::ONE);
+    ASSERT_EQ(qBar->GetState(), PinState::ZERO);
+
+    // Reset
+    nand2->GetInputPins()[1]->SetState(PinState::ZERO);
+    game.ComputeAllGates();
+    ASSERT_EQ(q->GetState(), PinState::ZERO);
+    ASSERT_EQ(qBar->GetState(), PinState::ONE);
+
+    // Release, the latch holds
+    nand2->GetInputPins()[1]->SetState(PinState::ONE);
+    game.ComputeAllGates();
+    ASSERT_EQ(q->GetState(), PinState::ZERO);
+    ASSERT_EQ(qBar->GetState(), PinState::ONE);
+}
+
+// A loop with no stable state is reported as unknown
+TEST(NetlistTest, Oscillator)
+{
+    Game game;
+    auto not1 = make_shared<NotGate>(&game);
+    auto not2 = make_shared<NotGate>(&game);
+    auto not3 = make_shared<NotGate>(&game);
+    game.Add(not1);
+    game.Add(not2);
+    game.Add(not3);
+    not1->GetOutputPins()[0]->ConnectTo(not2->GetInputPins()[0]);
+    not2->GetOutputPins()[0]->ConnectTo(not3->GetInputPins()[0]);
+    not3->GetOutputPins()[0]->ConnectTo(not1->GetInputPins()[0]);
+
+    not1->GetOutputPins()[0]->SetState(PinState::ONE);
+    not2->GetOutputPins()[0]->SetState(PinState::ZERO);
+    not3->GetOutputPins()[0]->SetState(PinState::ONE);
+
+    auto netlist = game.GetNetlist();
+    for (auto mode : {Netlist::EvaluationMode::EventDriven, Netlist::EvaluationMode::Compiled})
+    {
+        netlist->SetMode(mode);
+        game.ComputeAllGates();
+        ASSERT_EQ(not1->GetOutputPins()[0]->GetState(), PinState::UNKNOWN);
+        ASSERT_EQ(not2->GetOutputPins()[0]->GetState(), PinState::UNKNOWN);
+        ASSERT_EQ(not3->GetOutputPins()[0]->GetState(), PinState::UNKNOWN);
+
+        // Once unknown the loop is stable
+        game.ComputeAllGates();
+        ASSERT_EQ(netlist->GetEvaluatedCount(), mode == Netlist::EvaluationMode::EventDriven ? 0 : 3);
+    }
+}
+
+/**
+ * Build a wide circuit of NOT gates feeding AND gates
+ * @param game Game to add the gates to
+ * @param width Number of NOT gates
+ * @return The gates, NOT gates first
+ */
+static vector<shared_ptr<Gate>> BuildWideCircuit(Game& game, int width)
+{
+    vector<shared_ptr<Gate>> gates;
+    for (int i = 0; i < width; i++)
+    {
+        auto gate = make_shared<NotGate>(&game);
+        game.Add(gate);
+        gate->GetInputPins()[0]->SetState(i % 3 == 0 ? PinState::ONE : PinState::ZERO);
+        gates.push_back(gate);
+    }
+    for (int i = 0; i < width; i++)
+    {
+        auto gate = make_shared<AndGate>(&game);
+        game.Add(gate);
+        gates[i]->GetOutputPins()[0]->ConnectTo(gate->GetInputPins()[0]);
+        gates[(i * 7 + 1) % width]->GetOutputPins()[0]->ConnectTo(gate->GetInputPins()[1]);
+        gates.push_back(gate);
+    }
+    return gates;
+}
+
+// Calculating levels on several threads gives the same states as one thread
+TEST(NetlistTest, Parallel)
+{
+    const int width = 3000;
+    Game serialGame;
+    Game parallelGame;
+    auto serial = BuildWideCircuit(serialGame, width);
+    auto parallel = BuildWideCircuit(parallelGame, width);
+
+    auto netlist = parallelGame.GetNetlist();
+    netlist->SetThreadCount(4);
+    netlist->SetParallelThreshold(16);
+    ASSERT_EQ(netlist->GetThreadCount(), 4);
+
+    for (int step = 0; step < 3; step++)
+    {
+        serialGame.ComputeAllGates();
+        parallelGame.ComputeAllGates();
+        ASSERT_EQ(netlist->GetEvaluatedCount(), serialGame.GetNetlist()->GetEvaluatedCount());
+        for (size_t i = 0; i < serial.size(); i++)
+        {
+            ASSERT_EQ(parallel[i]->GetOutputPins()[0]->GetState(), serial[i]->GetOutputPins()[0]->GetState());
+        }
+
+        // Change some inputs for the next step
+        for (int i = step; i < width; i += 5)
+        {
+            serial[i]->GetInputPins()[0]->SetState(PinState::ONE);
+            parallel[i]->GetInputPins()[0]->SetState(PinState::ONE);
+        }
+    }
+}
+
+// Dead, constant and duplicate gates are left out of the schedule
+TEST(NetlistTest, Optimize)
+{
+    Game game;
+    auto netlist = game.GetNetlist();
+    netlist->SetOptimize(true);
+    netlist->SetClusterInputs(0);
+    netlist->SetMode(Netlist::EvaluationMode::Full);
+
+    // Pins outside the netlist, like a beam and Sparty's
+    auto source1 = make_shared<Pin>(&game, PinType::OUTPUT, 0, 0, PinState::ONE);
+    auto source2 = make_shared<Pin>(&game, PinType::OUTPUT, 0, 0, PinState::ONE);
+    vector<shared_ptr<Pin>> sinks;
+    for (int i = 0; i < 4; i++)
+    {
+        sinks.push_back(make_shared<Pin>(&game, PinType::INPUT, 0, 0));
+    }
+
+    auto and1 = make_shared<AndGate>(&game);
+    auto and2 = make_shared<AndGate>(&game);
+    auto orGate = make_shared<OrGate>(&game);
+    auto dead = make_shared<NotGate>(&game);
+    auto constant = make_shared<NotGate>(&game);
+    auto and3 = make_shared<AndGate>(&game);
+    auto half = make_shared<AndGate>(&game);
+    for (auto gate : vector<shared_ptr<Gate>>{and1, and2, orGate, dead, constant, and3, half})
+    {
+        game.Add(gate);
+    }
+
+    // and2 has the same inputs as and1, the other way around
+    source1->ConnectTo(and1->GetInputPins()[0]);
+    source2->ConnectTo(and1->GetInputPins()[1]);
+    source2->ConnectTo(and2->GetInputPins()[0]);
+    source1->ConnectTo(and2->GetInputPins()[1]);
+    and1->GetOutputPins()[0]->ConnectTo(orGate->GetInputPins()[0]);
+    and2->GetOutputPins()[0]->ConnectTo(orGate->GetInputPins()[1]);
+    orGate->GetOutputPins()[0]->ConnectTo(sinks[0]);
+
+    // dead drives nothing
+    source1->ConnectTo(dead->GetInputPins()[0]);
+
+    // constant has an input nothing can change
+    constant->GetInputPins()[0]->SetState(PinState::ZERO);
+    constant->GetOutputPins()[0]->ConnectTo(and3->GetInputPins()[0]);
+    source1->ConnectTo(and3->GetInputPins()[1]);
+    and3->GetOutputPins()[0]->ConnectTo(sinks[1]);
+
+    // half has an unwired input as well as a live one
+    source1->ConnectTo(half->GetInputPins()[0]);
+    half->GetOutputPins()[0]->ConnectTo(sinks[2]);
+
+    game.ComputeAllGates();
+    ASSERT_EQ(and1->GetRole(), GateRole::Evaluated);
+    ASSERT_EQ(and2->GetRole(), GateRole::Merged);
+    ASSERT_EQ(orGate->GetRole(), GateRole::Evaluated);
+    ASSERT_EQ(dead->GetRole(), GateRole::Dead);
+    ASSERT_EQ(constant->GetRole(), GateRole::Constant);
+    ASSERT_EQ(and3->GetRole(), GateRole::Evaluated);
+    ASSERT_EQ(half->GetRole(), GateRole::Evaluated);
+    ASSERT_EQ(netlist->GetEvaluatedCount(), 4);
+
+    ASSERT_EQ(and2->GetOutputPins()[0]->GetState(), PinState::ONE);
+    ASSERT_EQ(sinks[0]->GetState(), PinState::ONE);
+    ASSERT_EQ(sinks[1]->GetState(), PinState::ONE);
+    ASSERT_EQ(sinks[2]->GetState(), PinState::UNKNOWN);
+
+    source2->SetState(PinState::ZERO);
+    game.ComputeAllGates();
+    ASSERT_EQ(and2->GetOutputPins()[0]->GetState(), PinState::ZERO);
+    ASSERT_EQ(sinks[0]->GetState(), PinState::ZERO);
+
+    // A change on the live input of half does not fold it
+    source1->SetState(PinState::ZERO);
+    game.ComputeAllGates();
+    ASSERT_EQ(half->GetRole(), GateRole::Evaluated);
+    ASSERT_EQ(sinks[2]->GetState(), PinState::UNKNOWN);
+    source1->SetState(PinState::ONE);
+    game.ComputeAllGates();
+
+    // Changing a constant input folds the gates again
+    constant->GetInputPins()[0]->SetState(PinState::ONE);
+    game.ComputeAllGates();
+    ASSERT_EQ(sinks[1]->GetState(), PinState::ZERO);
+
+    // Wiring up a dead gate brings it back
+    dead->GetOutputPins()[0]->ConnectTo(sinks[3]);
+    game.ComputeAllGates();
+    ASSERT_EQ(dead->GetRole(), GateRole::Evaluated);
+    ASSERT_EQ(sinks[3]->GetState(), PinState::ZERO);
+}
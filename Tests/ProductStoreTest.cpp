@@ -0,0 +1,63 @@
+/**
+ * @file ProductStoreTest.cpp
+ * @author Ethan Springer, Daksh Mehta, Sehaj Gupta, Lukas Schaefer, Jack McNamara
+ */
+
+#include <pch.h>
+#include <gtest/gtest.h>
+#include <ProductStore.h>
+
+using namespace std;
+
+// Products follow the belt until kicked, then move left
+TEST(ProductStoreTest, Update)
+{
+    ProductStore store;
+    for (int i = 0; i < 10; i++)
+    {
+        ASSERT_EQ(store.Add(), size_t(i));
+        store.SetBaseY(i, -100.0 * i);
+    }
+
+    store.Update(0.1, 50, 1e9);
+    store.SetKickSpeed(3, 1000);
+    store.Update(0.1, 60, 1e9);
+    for (size_t i = 0; i < store.GetSize(); i++)
+    {
+        ASSERT_DOUBLE_EQ(store.GetOffsetY(i), i == 3 ? 50 : 60);
+        ASSERT_DOUBLE_EQ(store.GetOffsetX(i), i == 3 ? -100 : 0);
+    }
+
+    store.Reset();
+    ASSERT_DOUBLE_EQ(store.GetOffsetX(3), 0);
+    ASSERT_DOUBLE_EQ(store.GetOffsetY(5), 0);
+    ASSERT_DOUBLE_EQ(store.GetKickSpeed(3), 0);
+
+    store.Clear();
+    ASSERT_EQ(store.GetSize(), 0);
+}
+
+// Only products still on the belt pass the kick line, once
+TEST(ProductStoreTest, Passed)
+{
+    ProductStore store;
+    for (int i = 0; i < 4; i++)
+    {
+        store.Add();
+        store.SetBaseY(i, -100.0 * i);
+    }
+    store.SetShouldKick(1, true);
+
+    // Product 0 reaches 250 and product 1 reaches 150
+    store.Update(0.1, 250, 200);
+    ASSERT_EQ(store.GetPassed(), vector<size_t>({0}));
+    ASSERT_FALSE(store.ShouldKick(0));
+
+    store.SetKickSpeed(2, 1000);
+    store.Update(0.1, 350, 200);
+    ASSERT_EQ(store.GetPassed(), vector<size_t>({1}));
+    ASSERT_TRUE(store.ShouldKick(1));
+
+    store.Update(0.1, 450, 200);
+    ASSERT_TRUE(store.GetPassed().empty());
+}
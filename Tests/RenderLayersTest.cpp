@@ -0,0 +1,85 @@
+/**
+ * @file RenderLayersTest.cpp
+ * @author Ethan Springer, Daksh Mehta, Sehaj Gupta, Lukas Schaefer, Jack McNamara
+ */
+
+#include <pch.h>
+#include <gtest/gtest.h>
+#include <RenderLayers.h>
+#include <Game.h>
+#include <NotGate.h>
+#include <Product.h>
+#include <Sparty.h>
+#include <memory>
+
+using namespace std;
+
+/**
+ * Get the items of a layer in drawing order
+ * @param layers The layers
+ * @param layer Layer to list
+ * @return The items, bottom to top
+ */
+static vector<Item*> Order(const RenderLayers& layers, Layer layer)
+{
+    vector<Item*> items;
+    layers.ForEach(layer, [&items](Item* item) { items.push_back(item); });
+    return items;
+}
+
+// Items go to the top of their own layer whatever order they are added in
+TEST(RenderLayersTest, Layers)
+{
+    Game game;
+    auto gate1 = make_shared<NotGate>(&game);
+    auto product = make_shared<Product>(&game, 0);
+    auto sparty = make_shared<Sparty>(&game);
+    auto gate2 = make_shared<NotGate>(&game);
+
+    RenderLayers layers;
+    layers.Insert(gate1.get());
+    layers.Insert(product.get());
+    layers.Insert(sparty.get());
+    layers.Insert(gate2.get());
+
+    ASSERT_EQ(Order(layers, Layer::Conveyor), vector<Item*>({product.get()}));
+    ASSERT_EQ(Order(layers, Layer::Machines), vector<Item*>({sparty.get()}));
+    ASSERT_EQ(Order(layers, Layer::Gates), vector<Item*>({gate1.get(), gate2.get()}));
+    ASSERT_TRUE(Order(layers, Layer::Overlay).empty());
+    ASSERT_EQ(layers.GetTop(Layer::Gates), gate2.get());
+
+    layers.Clear();
+    ASSERT_TRUE(Order(layers, Layer::Gates).empty());
+    ASSERT_EQ(layers.GetTop(Layer::Conveyor), nullptr);
+}
+
+// Raising and removing keep the rest of the layer in order
+TEST(RenderLayersTest, Raise)
+{
+    Game game;
+    vector<shared_ptr<NotGate>> gates;
+    RenderLayers layers;
+    for (int i = 0; i < 4; i++)
+    {
+        gates.push_back(make_shared<NotGate>(&game));
+        layers.Insert(gates.back().get());
+    }
+
+    layers.Raise(gates[0].get());
+    layers.Raise(gates[2].get());
+    ASSERT_EQ(Order(layers, Layer::Gates),
+              vector<Item*>({gates[1].get(), gates[3].get(), gates[0].get(), gates[2].get()}));
+
+    // Raising the top item or one not in a layer changes nothing
+    layers.Raise(gates[2].get());
+    auto loose = make_shared<NotGate>(&game);
+    layers.Raise(loose.get());
+    ASSERT_EQ(layers.GetTop(Layer::Gates), gates[2].get());
+
+    layers.Remove(gates[3].get());
+    layers.Remove(gates[2].get());
+    ASSERT_EQ(Order(layers, Layer::Gates), vector<Item*>({gates[1].get(), gates[0].get()}));
+
+    layers.Insert(gates[3].get());
+    ASSERT_EQ(layers.GetTop(Layer::Gates), gates[3].get());
+}
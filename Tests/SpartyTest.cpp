@@ -8,6 +8,9 @@
 
 #include <Game.h>
 #include <Sparty.h>
+#include <Conveyor.h>
+#include <ClockGate.h>
+#include <memory>
 
 TEST(SpartyTest, XmlLoad)
 {
@@ -20,4 +23,52 @@ TEST(SpartyTest, XmlLoad)
     EXPECT_EQ(sparty.GetX(), 200);
     EXPECT_EQ(sparty.GetY(), 500);
     delete node;
-}
\ No newline at end of file
+}
+// A pulse on the pin shorter than a frame still starts a kick
+TEST(SpartyTest, ShortPulseKicks)
+{
+    Game game;
+    game.SetTickRate(1000);
+
+    auto conveyor = std::make_shared<Conveyor>(&game);
+    auto node = new wxXmlNode(wxXML_ELEMENT_NODE, L"conveyor");
+    node->AddAttribute(L"x", L"300");
+    node->AddAttribute(L"y", L"200");
+    node->AddAttribute(L"speed", L"100");
+    node->AddAttribute(L"panel", L"0,0");
+    conveyor->XmlLoad(node);
+    delete node;
+    game.Add(conveyor);
+
+    // Press the start button
+    conveyor->HitTest(300 + StartButtonRect.x + 1, 200 + StartButtonRect.y + 1);
+    ASSERT_TRUE(conveyor->IsRunning());
+
+    auto sparty = std::make_shared<Sparty>(&game);
+    node = new wxXmlNode(wxXML_ELEMENT_NODE, L"sparty");
+    node->AddAttribute(L"x", L"1000");
+    node->AddAttribute(L"y", L"400");
+    sparty->XmlLoad(node);
+    delete node;
+    game.Add(sparty);
+
+    // The clock changes every tick, so it is the same at the end of
+    // every two tick frame and only a check each tick sees it rise
+    auto clock = std::make_shared<ClockGate>(&game);
+    clock->SetHalfPeriod(1);
+    game.Add(clock);
+    clock->GetOutputPins()[0]->ConnectTo(sparty->GetPin());
+
+    int kicks = 0;
+    bool kicking = sparty->IsKicking();
+    for (int frame = 0; frame < 500; frame++)
+    {
+        game.Update(0.002);
+        if (sparty->IsKicking() && !kicking)
+        {
+            kicks++;
+        }
+        kicking = sparty->IsKicking();
+    }
+    ASSERT_GE(kicks, 3);
+}
@@ -0,0 +1,48 @@
+/**
+ * @file ThreadPoolTest.cpp
+ * @author Ethan Springer, Daksh Mehta, Sehaj Gupta, Lukas Schaefer, Jack McNamara
+ */
+
+#include <pch.h>
+#include <gtest/gtest.h>
+#include <ThreadPool.h>
+#include <vector>
+
+using namespace std;
+
+// Every index is visited exactly once, loop after loop
+TEST(ThreadPoolTest, ParallelFor)
+{
+    ThreadPool pool(4);
+    ASSERT_EQ(pool.GetThreadCount(), 4);
+
+    vector<int> visits(10007, 0);
+    for (int loop = 0; loop < 20; loop++)
+    {
+        pool.ParallelFor(visits.size(), 64, [&visits](size_t begin, size_t end)
+        {
+            ASSERT_LE(end - begin, 64);
+            for (size_t i = begin; i < end; i++)
+            {
+                visits[i]++;
+            }
+        });
+    }
+
+    for (int count : visits)
+    {
+        ASSERT_EQ(count, 20);
+    }
+}
+
+// A pool of one thread runs the loop on the calling thread
+TEST(ThreadPoolTest, SingleThread)
+{
+    ThreadPool pool(1);
+    size_t total = 0;
+    pool.ParallelFor(100, 7, [&total](size_t begin, size_t end) { total += end - begin; });
+    ASSERT_EQ(total, 100);
+
+    pool.ParallelFor(0, 7, [&total](size_t begin, size_t end) { total = 0; });
+    ASSERT_EQ(total, 100);
+}
@@ -0,0 +1,155 @@
+/**
+ * @file TimingWheelTest.cpp
+ * @author Ethan Springer, Daksh Mehta, Sehaj Gupta, Lukas Schaefer, Jack McNamara
+ */
+
+#include <pch.h>
+#include <gtest/gtest.h>
+#include <TimingWheel.h>
+#include <Netlist.h>
+#include <AndGate.h>
+#include <DflipFlop.h>
+#include <NotGate.h>
+#include <Game.h>
+#include <memory>
+
+using namespace std;
+
+// Changes come off the wheel once their delay has passed, in order
+TEST(TimingWheelTest, Advance)
+{
+    Game game;
+    auto gate = make_shared<NotGate>(&game);
+    Pin* pin = gate->GetOutputPins()[0].get();
+
+    TimingWheel wheel;
+    vector<TimingWheel::Event> due;
+    wheel.Schedule(2, pin, PinState::ONE);
+    wheel.Schedule(1, pin, PinState::ZERO);
+    wheel.Schedule(2, pin, PinState::ZERO);
+    ASSERT_EQ(wheel.GetPending(), 3);
+
+    wheel.Advance(due);
+    ASSERT_EQ(due.size(), 1);
+    ASSERT_EQ(due[0].state, PinState::ZERO);
+
+    wheel.Advance(due);
+    ASSERT_EQ(due.size(), 2);
+    ASSERT_EQ(due[0].state, PinState::ONE);
+    ASSERT_EQ(due[1].state, PinState::ZERO);
+    ASSERT_TRUE(wheel.IsEmpty());
+
+    wheel.Schedule(3, pin, PinState::ONE);
+    wheel.Cancel(gate.get());
+    ASSERT_TRUE(wheel.IsEmpty());
+}
+
+/**
+ * Build A -> NOT -> AND <- A with the AND clocking a flip flop
+ * whose D input is ONE
+ * @param game Game to add the gates to
+ * @param source Gate whose output is A, set to ZERO
+ * @return The flip flop
+ */
+static shared_ptr<DflipFlop> BuildGlitch(Game& game, shared_ptr<NotGate>& source)
+{
+    source = make_shared<NotGate>(&game);
+    auto inverter = make_shared<NotGate>(&game);
+    auto andGate = make_shared<AndGate>(&game);
+    auto dff = make_shared<DflipFlop>(&game);
+    game.Add(source);
+    game.Add(inverter);
+    game.Add(andGate);
+    game.Add(dff);
+
+    auto a = source->GetOutputPins()[0];
+    a->ConnectTo(inverter->GetInputPins()[0]);
+    a->ConnectTo(andGate->GetInputPins()[0]);
+    inverter->GetOutputPins()[0]->ConnectTo(andGate->GetInputPins()[1]);
+    andGate->GetOutputPins()[0]->ConnectTo(dff->GetInputPins()[1]);
+    dff->GetInputPins()[0]->SetState(PinState::ONE);
+    source->GetInputPins()[0]->SetState(PinState::ONE);
+    return dff;
+}
+
+// The unequal paths to the AND gate give a pulse that clocks the flip flop
+TEST(TimingWheelTest, Glitch)
+{
+    Game game;
+    shared_ptr<NotGate> source;
+    auto dff = BuildGlitch(game, source);
+    auto netlist = game.GetNetlist();
+    netlist->SetMode(Netlist::EvaluationMode::Timed);
+    for (int tick = 0; tick < 3; tick++)
+    {
+        netlist->Evaluate();
+    }
+    ASSERT_NE(dff->GetOutputPins()[0]->GetState(), PinState::ONE);
+
+    source->GetInputPins()[0]->SetState(PinState::ZERO);
+    netlist->Evaluate();
+    ASSERT_EQ(dff->GetOutputPins()[0]->GetState(), PinState::ONE);
+}
+
+// Without delays the AND gate only sees the settled inputs
+TEST(TimingWheelTest, NoGlitch)
+{
+    Game game;
+    shared_ptr<NotGate> source;
+    auto dff = BuildGlitch(game, source);
+    auto netlist = game.GetNetlist();
+    for (int tick = 0; tick < 3; tick++)
+    {
+        netlist->Evaluate();
+    }
+
+    source->GetInputPins()[0]->SetState(PinState::ZERO);
+    netlist->Evaluate();
+    ASSERT_NE(dff->GetOutputPins()[0]->GetState(), PinState::ONE);
+}
+
+// A change takes one time unit per NOT gate to get down a chain
+TEST(TimingWheelTest, Delay)
+{
+    Game game;
+    vector<shared_ptr<NotGate>> chain;
+    for (int i = 0; i < 20; i++)
+    {
+        chain.push_back(make_shared<NotGate>(&game));
+        game.Add(chain.back());
+        if (i > 0)
+        {
+            chain[i - 1]->GetOutputPins()[0]->ConnectTo(chain[i]->GetInputPins()[0]);
+        }
+    }
+    auto input = chain.front()->GetInputPins()[0];
+    auto output = chain.back()->GetOutputPins()[0];
+
+    auto netlist = game.GetNetlist();
+    netlist->SetMode(Netlist::EvaluationMode::Timed);
+    input->SetState(PinState::ZERO);
+    netlist->Evaluate();
+    netlist->Evaluate();
+    ASSERT_EQ(output->GetState(), PinState::ZERO);
+
+    // A quiet circuit costs nothing
+    netlist->Evaluate();
+    ASSERT_EQ(netlist->GetEvaluatedCount(), 0);
+    ASSERT_TRUE(netlist->GetWheel().IsEmpty());
+
+    // Twenty units is more than one tick
+    input->SetState(PinState::ONE);
+    netlist->Evaluate();
+    ASSERT_EQ(output->GetState(), PinState::ZERO);
+    ASSERT_FALSE(netlist->GetWheel().IsEmpty());
+    netlist->Evaluate();
+    ASSERT_EQ(output->GetState(), PinState::ONE);
+
+    // Changes still on the wheel happen when leaving timed mode
+    input->SetState(PinState::ZERO);
+    netlist->Evaluate();
+    netlist->SetMode(Netlist::EvaluationMode::EventDriven);
+    ASSERT_TRUE(netlist->GetWheel().IsEmpty());
+    netlist->Evaluate();
+    ASSERT_EQ(output->GetState(), PinState::ZERO);
+}
@@ -0,0 +1,126 @@
+/**
+ * @file TruthTableTest.cpp
+ * @author Ethan Springer, Daksh Mehta, Sehaj Gupta, Lukas Schaefer, Jack McNamara
+ */
+
+#include <pch.h>
+#include <gtest/gtest.h>
+#include <TruthTable.h>
+#include <AndGate.h>
+#include <OrGate.h>
+#include <NotGate.h>
+#include <Game.h>
+#include <memory>
+
+using namespace std;
+
+/**
+ * A cluster computing (a AND b) OR NOT c, wired from pins
+ * outside the netlist to a sink outside it
+ */
+class TruthTableTest : public ::testing::Test
+{
+protected:
+    Game mGame;
+    vector<shared_ptr<Pin>> mSources;
+    shared_ptr<Pin> mSink;
+    shared_ptr<AndGate> mAnd;
+    shared_ptr<NotGate> mNot;
+    shared_ptr<OrGate> mOr;
+
+    void SetUp() override
+    {
+        for (int i = 0; i < 3; i++)
+        {
+            mSources.push_back(make_shared<Pin>(&mGame, PinType::OUTPUT, 0, 0, PinState::ZERO));
+        }
+        mSink = make_shared<Pin>(&mGame, PinType::INPUT, 0, 0);
+
+        mAnd = make_shared<AndGate>(&mGame);
+        mNot = make_shared<NotGate>(&mGame);
+        mOr = make_shared<OrGate>(&mGame);
+        mGame.Add(mAnd);
+        mGame.Add(mNot);
+        mGame.Add(mOr);
+
+        mSources[0]->ConnectTo(mAnd->GetInputPins()[0]);
+        mSources[1]->ConnectTo(mAnd->GetInputPins()[1]);
+        mSources[2]->ConnectTo(mNot->GetInputPins()[0]);
+        mAnd->GetOutputPins()[0]->ConnectTo(mOr->GetInputPins()[0]);
+        mNot->GetOutputPins()[0]->ConnectTo(mOr->GetInputPins()[1]);
+        mOr->GetOutputPins()[0]->ConnectTo(mSink);
+
+        mGame.GetNetlist()->SetOptimize(true);
+    }
+};
+
+// The table gives the same outputs as the gates for every input
+TEST_F(TruthTableTest, Lookup)
+{
+    auto netlist = mGame.GetNetlist();
+    for (int combination = 0; combination < 8; combination++)
+    {
+        bool a = combination & 1;
+        bool b = combination & 2;
+        bool c = combination & 4;
+        mSources[0]->SetState(a ? PinState::ONE : PinState::ZERO);
+        mSources[1]->SetState(b ? PinState::ONE : PinState::ZERO);
+        mSources[2]->SetState(c ? PinState::ONE : PinState::ZERO);
+        mGame.ComputeAllGates();
+
+        ASSERT_EQ(netlist->GetTables().size(), 1);
+        ASSERT_EQ(mSink->GetState(), ((a && b) || !c) ? PinState::ONE : PinState::ZERO);
+        ASSERT_EQ(mAnd->GetOutputPins()[0]->GetState(), (a && b) ? PinState::ONE : PinState::ZERO);
+    }
+
+    auto& table = *netlist->GetTables()[0];
+    ASSERT_EQ(table.GetInputCount(), 3);
+    ASSERT_EQ(table.GetOutputCount(), 3);
+    ASSERT_EQ(mOr->GetRole(), GateRole::Clustered);
+
+    // One lookup instead of three gates
+    mSources[2]->SetState(PinState::ZERO);
+    mGame.ComputeAllGates();
+    ASSERT_EQ(netlist->GetEvaluatedCount(), 1);
+
+    // An unknown input only reaches the outputs that depend on it
+    mSources[0]->SetState(PinState::UNKNOWN);
+    mGame.ComputeAllGates();
+    ASSERT_EQ(mNot->GetOutputPins()[0]->GetState(), PinState::ONE);
+    ASSERT_EQ(mSink->GetState(), PinState::UNKNOWN);
+}
+
+// Rewiring a gate in the cluster builds the table again
+TEST_F(TruthTableTest, Rewire)
+{
+    mSources[0]->SetState(PinState::ONE);
+    mSources[1]->SetState(PinState::ONE);
+    mSources[2]->SetState(PinState::ONE);
+    mGame.ComputeAllGates();
+    ASSERT_EQ(mSink->GetState(), PinState::ONE);
+
+    // The AND now reads c instead of b
+    mSources[2]->ConnectTo(mAnd->GetInputPins()[1]);
+    mSources[1]->SetState(PinState::ZERO);
+    mSources[2]->SetState(PinState::ZERO);
+    mGame.ComputeAllGates();
+    ASSERT_EQ(mGame.GetNetlist()->GetTables()[0]->GetInputCount(), 2);
+    ASSERT_EQ(mSink->GetState(), PinState::ONE);
+
+    mSources[2]->SetState(PinState::ONE);
+    mGame.ComputeAllGates();
+    ASSERT_EQ(mSink->GetState(), PinState::ONE);
+
+    mSources[0]->SetState(PinState::ZERO);
+    mGame.ComputeAllGates();
+    ASSERT_EQ(mSink->GetState(), PinState::ZERO);
+}
+
+// Clusters with too many inputs are left as gates
+TEST_F(TruthTableTest, InputLimit)
+{
+    mGame.GetNetlist()->SetClusterInputs(2);
+    mGame.ComputeAllGates();
+    ASSERT_TRUE(mGame.GetNetlist()->GetTables().empty());
+    ASSERT_EQ(mOr->GetRole(), GateRole::Evaluated);
+}